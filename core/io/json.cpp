@@ -593,6 +593,541 @@ void JSON::_bind_methods() {
 
 ////
 
+void JSONReader::_reset() {
+	file.unref();
+	stream.unref();
+	source_buffer.clear();
+	source_pos = 0;
+	source_eof = true;
+	stream_ended = false;
+
+	pending_bytes.clear();
+	buffer.clear();
+	buffer.push_back(0);
+	buffer_pos = 0;
+	read_start_pos = 0;
+
+	stack.clear();
+	root_read = false;
+	finished = false;
+	failed = false;
+
+	event_type = EVENT_NONE;
+	value = Variant();
+	current_line = 0;
+	err_str = String();
+	err_line = 0;
+}
+
+Error JSONReader::open(const String &p_path) {
+	_reset();
+
+	Error err;
+	file = FileAccess::open(p_path, FileAccess::READ, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Cannot open file '" + p_path + "'.");
+	source_eof = false;
+
+	return OK;
+}
+
+Error JSONReader::open_file(const Ref<FileAccess> &p_file) {
+	ERR_FAIL_COND_V(p_file.is_null(), ERR_INVALID_PARAMETER);
+	_reset();
+
+	file = p_file;
+	source_eof = false;
+
+	return OK;
+}
+
+Error JSONReader::open_buffer(const Vector<uint8_t> &p_buffer) {
+	_reset();
+
+	source_buffer = p_buffer;
+	source_eof = false;
+
+	return OK;
+}
+
+Error JSONReader::open_stream(const Ref<StreamPeer> &p_stream) {
+	ERR_FAIL_COND_V(p_stream.is_null(), ERR_INVALID_PARAMETER);
+	_reset();
+
+	stream = p_stream;
+	source_eof = false;
+
+	return OK;
+}
+
+void JSONReader::end_stream() {
+	ERR_FAIL_COND_MSG(stream.is_null(), "The reader must be reading from a stream.");
+	stream_ended = true;
+}
+
+void JSONReader::close() {
+	_reset();
+}
+
+bool JSONReader::_fill_buffer() {
+	// Read straight after the bytes left over from the previous chunk.
+	const int pending_size = pending_bytes.size();
+	pending_bytes.resize(pending_size + READ_CHUNK_SIZE);
+	uint8_t *chunk = pending_bytes.ptr() + pending_size;
+	int64_t received = 0;
+
+	if (file.is_valid()) {
+		received = file->get_buffer(chunk, READ_CHUNK_SIZE);
+		if (received < READ_CHUNK_SIZE) {
+			source_eof = true;
+		}
+	} else if (stream.is_valid()) {
+		int stream_received = 0;
+		Error err = stream->get_partial_data(chunk, MIN(stream->get_available_bytes(), (int)READ_CHUNK_SIZE), stream_received);
+		if (err != OK || (stream_ended && stream->get_available_bytes() == 0)) {
+			source_eof = true;
+		}
+		received = stream_received;
+	} else {
+		received = MIN(source_buffer.size() - source_pos, (int64_t)READ_CHUNK_SIZE);
+		memcpy(chunk, source_buffer.ptr() + source_pos, received);
+		source_pos += received;
+		if (source_pos == source_buffer.size()) {
+			source_eof = true;
+		}
+	}
+
+	pending_bytes.resize(pending_size + received);
+
+	if (received == 0 && !source_eof) {
+		return false; // Nothing available yet.
+	}
+
+	// Keep an incomplete UTF-8 sequence at the end for the next chunk.
+	int decode_size = pending_bytes.size();
+	if (!source_eof) {
+		int lead = decode_size - 1;
+		while (lead > 0 && lead > decode_size - 4 && (pending_bytes[lead] & 0xc0) == 0x80) {
+			lead--;
+		}
+		if (lead >= 0) {
+			const uint8_t c = pending_bytes[lead];
+			int sequence_size = 1;
+			if ((c & 0xe0) == 0xc0) {
+				sequence_size = 2;
+			} else if ((c & 0xf0) == 0xe0) {
+				sequence_size = 3;
+			} else if ((c & 0xf8) == 0xf0) {
+				sequence_size = 4;
+			}
+			if (lead + sequence_size > decode_size) {
+				decode_size = lead;
+			}
+		}
+	}
+
+	// Drop the characters of the events which were already read.
+	const int remaining = buffer.size() - 1 - read_start_pos;
+	if (read_start_pos > 0) {
+		memmove(buffer.ptr(), buffer.ptr() + read_start_pos, remaining * sizeof(char32_t));
+		buffer_pos -= read_start_pos;
+		read_start_pos = 0;
+	}
+	buffer.resize(remaining);
+
+	if (decode_size > 0) {
+		String decoded;
+		decoded.parse_utf8((const char *)pending_bytes.ptr(), decode_size);
+		for (int i = 0; i < decoded.length(); i++) {
+			buffer.push_back(decoded[i]);
+		}
+
+		const int leftover = pending_bytes.size() - decode_size;
+		memmove(pending_bytes.ptr(), pending_bytes.ptr() + decode_size, leftover);
+		pending_bytes.resize(leftover);
+	}
+	buffer.push_back(0);
+
+	return true;
+}
+
+Error JSONReader::_next_token(JSON::Token &r_token) {
+	while (true) {
+		int index = buffer_pos;
+		int line = current_line;
+		const int len = buffer.size() - 1;
+
+		Error err = OK;
+		String token_error;
+		if (buffer_pos >= len) {
+			r_token.type = JSON::TK_EOF;
+		} else {
+			err = JSON::_get_token(buffer.ptr(), index, len, r_token, line, token_error);
+		}
+
+		// Numbers, identifiers and errors may just be cut at the end of the buffer.
+		bool truncated;
+		if (err != OK) {
+			truncated = index + TOKEN_LOOKAHEAD >= len;
+		} else {
+			truncated = index >= len && (r_token.type == JSON::TK_NUMBER || r_token.type == JSON::TK_IDENTIFIER || r_token.type == JSON::TK_EOF);
+		}
+
+		if (truncated && !source_eof) {
+			if (!_fill_buffer()) {
+				return ERR_BUSY;
+			}
+			continue;
+		}
+
+		buffer_pos = index;
+		current_line = line;
+		if (err != OK) {
+			err_str = token_error;
+		}
+		return err;
+	}
+}
+
+Error JSONReader::_fail(const String &p_message) {
+	err_str = p_message;
+	err_line = current_line;
+	failed = true;
+	event_type = EVENT_NONE;
+	value = Variant();
+	return ERR_PARSE_ERROR;
+}
+
+Error JSONReader::_read_value(const JSON::Token &p_token) {
+	root_read = true;
+	value = Variant();
+
+	switch (p_token.type) {
+		case JSON::TK_CURLY_BRACKET_OPEN:
+		case JSON::TK_BRACKET_OPEN: {
+			if ((int)stack.size() >= Variant::MAX_RECURSION_DEPTH) {
+				return _fail("JSON structure is too deep. Bailing.");
+			}
+			Container container;
+			container.is_object = p_token.type == JSON::TK_CURLY_BRACKET_OPEN;
+			stack.push_back(container);
+			event_type = container.is_object ? EVENT_OBJECT_BEGIN : EVENT_ARRAY_BEGIN;
+			return OK;
+		}
+		case JSON::TK_IDENTIFIER: {
+			String id = p_token.value;
+			if (id == "true") {
+				value = true;
+			} else if (id == "false") {
+				value = false;
+			} else if (id != "null") {
+				return _fail("Expected 'true','false' or 'null', got '" + id + "'.");
+			}
+			event_type = EVENT_VALUE;
+			return OK;
+		}
+		case JSON::TK_NUMBER:
+		case JSON::TK_STRING: {
+			value = p_token.value;
+			event_type = EVENT_VALUE;
+			return OK;
+		}
+		default: {
+			return _fail("Expected value, got " + String(JSON::tk_name[p_token.type]) + ".");
+		}
+	}
+}
+
+Error JSONReader::read() {
+	ERR_FAIL_COND_V_MSG(buffer.is_empty(), ERR_UNCONFIGURED, "The reader must be opened first.");
+	if (failed) {
+		return ERR_PARSE_ERROR;
+	}
+	if (finished) {
+		return ERR_FILE_EOF;
+	}
+
+	// Restore the state if more data is needed from a stream, so the next call resumes from there.
+	read_start_pos = buffer_pos;
+	const int start_line = current_line;
+	const Container start_container = stack.is_empty() ? Container() : stack[stack.size() - 1];
+
+	while (true) {
+		JSON::Token token;
+		Error err = _next_token(token);
+		if (err == ERR_BUSY) {
+			buffer_pos = read_start_pos;
+			current_line = start_line;
+			if (!stack.is_empty()) {
+				stack[stack.size() - 1] = start_container;
+			}
+			return ERR_BUSY;
+		}
+		if (err != OK) {
+			return _fail(err_str);
+		}
+
+		if (stack.is_empty()) {
+			if (root_read) {
+				if (token.type != JSON::TK_EOF) {
+					return _fail("Expected 'EOF'");
+				}
+				finished = true;
+				event_type = EVENT_NONE;
+				value = Variant();
+				return ERR_FILE_EOF;
+			}
+			return _read_value(token);
+		}
+
+		Container &container = stack[stack.size() - 1];
+
+		if (container.is_object && !container.at_value) {
+			if (token.type == JSON::TK_CURLY_BRACKET_CLOSE) {
+				stack.remove_at(stack.size() - 1);
+				event_type = EVENT_OBJECT_END;
+				value = Variant();
+				return OK;
+			}
+
+			if (container.need_comma) {
+				if (token.type != JSON::TK_COMMA) {
+					return _fail("Expected '}' or ','");
+				}
+				container.need_comma = false;
+				continue;
+			}
+
+			if (token.type != JSON::TK_STRING) {
+				return _fail("Expected key");
+			}
+
+			String key = token.value;
+			err = _next_token(token);
+			if (err == ERR_BUSY) {
+				buffer_pos = read_start_pos;
+				current_line = start_line;
+				stack[stack.size() - 1] = start_container;
+				return ERR_BUSY;
+			}
+			if (err != OK) {
+				return _fail(err_str);
+			}
+			if (token.type != JSON::TK_COLON) {
+				return _fail("Expected ':'");
+			}
+
+			container.at_value = true;
+			event_type = EVENT_KEY;
+			value = key;
+			return OK;
+		}
+
+		if (!container.is_object) {
+			if (token.type == JSON::TK_BRACKET_CLOSE) {
+				stack.remove_at(stack.size() - 1);
+				event_type = EVENT_ARRAY_END;
+				value = Variant();
+				return OK;
+			}
+
+			if (container.need_comma) {
+				if (token.type != JSON::TK_COMMA) {
+					return _fail("Expected ','");
+				}
+				container.need_comma = false;
+				continue;
+			}
+		}
+
+		// A value in an array, or after a key.
+		container.need_comma = true;
+		container.at_value = false;
+		return _read_value(token);
+	}
+}
+
+void JSONReader::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("open", "path"), &JSONReader::open);
+	ClassDB::bind_method(D_METHOD("open_file", "file"), &JSONReader::open_file);
+	ClassDB::bind_method(D_METHOD("open_buffer", "buffer"), &JSONReader::open_buffer);
+	ClassDB::bind_method(D_METHOD("open_stream", "stream"), &JSONReader::open_stream);
+	ClassDB::bind_method(D_METHOD("end_stream"), &JSONReader::end_stream);
+	ClassDB::bind_method(D_METHOD("close"), &JSONReader::close);
+
+	ClassDB::bind_method(D_METHOD("read"), &JSONReader::read);
+	ClassDB::bind_method(D_METHOD("get_event_type"), &JSONReader::get_event_type);
+	ClassDB::bind_method(D_METHOD("get_value"), &JSONReader::get_value);
+	ClassDB::bind_method(D_METHOD("get_depth"), &JSONReader::get_depth);
+	ClassDB::bind_method(D_METHOD("get_error_line"), &JSONReader::get_error_line);
+	ClassDB::bind_method(D_METHOD("get_error_message"), &JSONReader::get_error_message);
+
+	BIND_ENUM_CONSTANT(EVENT_NONE);
+	BIND_ENUM_CONSTANT(EVENT_OBJECT_BEGIN);
+	BIND_ENUM_CONSTANT(EVENT_OBJECT_END);
+	BIND_ENUM_CONSTANT(EVENT_ARRAY_BEGIN);
+	BIND_ENUM_CONSTANT(EVENT_ARRAY_END);
+	BIND_ENUM_CONSTANT(EVENT_KEY);
+	BIND_ENUM_CONSTANT(EVENT_VALUE);
+}
+
+////
+
+Error JSONWriter::open(const String &p_path, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Cannot open file '" + p_path + "'.");
+
+	return open_file(f, p_indent, p_sort_keys, p_full_precision);
+}
+
+Error JSONWriter::open_file(const Ref<FileAccess> &p_file, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
+	ERR_FAIL_COND_V(p_file.is_null(), ERR_INVALID_PARAMETER);
+
+	stack.clear();
+	root_written = false;
+
+	file = p_file;
+	indent = p_indent;
+	sort_keys = p_sort_keys;
+	full_precision = p_full_precision;
+
+	return OK;
+}
+
+Error JSONWriter::close() {
+	ERR_FAIL_COND_V(file.is_null(), ERR_UNCONFIGURED);
+
+	file.unref();
+	ERR_FAIL_COND_V_MSG(!stack.is_empty() || !root_written, ERR_INVALID_DATA, "Closed an incomplete JSON document.");
+
+	return OK;
+}
+
+void JSONWriter::_write_separator(Container &p_container) {
+	if (!p_container.empty) {
+		file->store_8(',');
+	}
+	p_container.empty = false;
+
+	if (!indent.is_empty()) {
+		file->store_string("\n" + JSON::_make_indent(indent, stack.size()));
+	}
+}
+
+Error JSONWriter::_begin_value() {
+	ERR_FAIL_COND_V(file.is_null(), ERR_UNCONFIGURED);
+
+	if (stack.is_empty()) {
+		ERR_FAIL_COND_V_MSG(root_written, ERR_ALREADY_EXISTS, "A JSON document can only have one root value.");
+		root_written = true;
+		return OK;
+	}
+
+	Container &container = stack[stack.size() - 1];
+	if (container.is_object) {
+		ERR_FAIL_COND_V_MSG(!container.at_value, ERR_INVALID_DATA, "Object values must follow a key.");
+		container.at_value = false;
+	} else {
+		_write_separator(container);
+	}
+
+	return OK;
+}
+
+Error JSONWriter::begin_object() {
+	Error err = _begin_value();
+	if (err != OK) {
+		return err;
+	}
+
+	file->store_8('{');
+	Container container;
+	container.is_object = true;
+	stack.push_back(container);
+
+	return OK;
+}
+
+Error JSONWriter::end_object() {
+	ERR_FAIL_COND_V(file.is_null(), ERR_UNCONFIGURED);
+	ERR_FAIL_COND_V_MSG(stack.is_empty() || !stack[stack.size() - 1].is_object, ERR_INVALID_DATA, "Not inside an object.");
+	ERR_FAIL_COND_V_MSG(stack[stack.size() - 1].at_value, ERR_INVALID_DATA, "The last key has no value.");
+
+	const bool empty = stack[stack.size() - 1].empty;
+	stack.remove_at(stack.size() - 1);
+	if (!empty && !indent.is_empty()) {
+		file->store_string("\n" + JSON::_make_indent(indent, stack.size()));
+	}
+	file->store_8('}');
+
+	return OK;
+}
+
+Error JSONWriter::begin_array() {
+	Error err = _begin_value();
+	if (err != OK) {
+		return err;
+	}
+
+	file->store_8('[');
+	stack.push_back(Container());
+
+	return OK;
+}
+
+Error JSONWriter::end_array() {
+	ERR_FAIL_COND_V(file.is_null(), ERR_UNCONFIGURED);
+	ERR_FAIL_COND_V_MSG(stack.is_empty() || stack[stack.size() - 1].is_object, ERR_INVALID_DATA, "Not inside an array.");
+
+	const bool empty = stack[stack.size() - 1].empty;
+	stack.remove_at(stack.size() - 1);
+	if (!empty && !indent.is_empty()) {
+		file->store_string("\n" + JSON::_make_indent(indent, stack.size()));
+	}
+	file->store_8(']');
+
+	return OK;
+}
+
+Error JSONWriter::write_key(const String &p_key) {
+	ERR_FAIL_COND_V(file.is_null(), ERR_UNCONFIGURED);
+	ERR_FAIL_COND_V_MSG(stack.is_empty() || !stack[stack.size() - 1].is_object, ERR_INVALID_DATA, "Keys can only be written inside an object.");
+
+	Container &container = stack[stack.size() - 1];
+	ERR_FAIL_COND_V_MSG(container.at_value, ERR_INVALID_DATA, "The last key has no value.");
+
+	_write_separator(container);
+	file->store_string("\"" + p_key.json_escape() + (indent.is_empty() ? "\":" : "\": "));
+	container.at_value = true;
+
+	return OK;
+}
+
+Error JSONWriter::write_value(const Variant &p_value) {
+	Error err = _begin_value();
+	if (err != OK) {
+		return err;
+	}
+
+	HashSet<const void *> markers;
+	file->store_string(JSON::_stringify(p_value, indent, stack.size(), sort_keys, markers, full_precision));
+
+	return OK;
+}
+
+void JSONWriter::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("open", "path", "indent", "sort_keys", "full_precision"), &JSONWriter::open, DEFVAL(""), DEFVAL(true), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("open_file", "file", "indent", "sort_keys", "full_precision"), &JSONWriter::open_file, DEFVAL(""), DEFVAL(true), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("close"), &JSONWriter::close);
+
+	ClassDB::bind_method(D_METHOD("begin_object"), &JSONWriter::begin_object);
+	ClassDB::bind_method(D_METHOD("end_object"), &JSONWriter::end_object);
+	ClassDB::bind_method(D_METHOD("begin_array"), &JSONWriter::begin_array);
+	ClassDB::bind_method(D_METHOD("end_array"), &JSONWriter::end_array);
+	ClassDB::bind_method(D_METHOD("write_key", "key"), &JSONWriter::write_key);
+	ClassDB::bind_method(D_METHOD("write_value", "value"), &JSONWriter::write_value);
+}
+
 ////////////
 
 Ref<Resource> ResourceFormatLoaderJSON::load(const String &p_path, const String &p_original_path, Error *r_error, bool p_use_sub_threads, float *r_progress, CacheMode p_cache_mode) {
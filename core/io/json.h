@@ -31,14 +31,20 @@
 #ifndef JSON_H
 #define JSON_H
 
+#include "core/io/file_access.h"
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/io/stream_peer.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/variant.h"
 
 class JSON : public Resource {
 	GDCLASS(JSON, Resource);
 
+	friend class JSONReader;
+	friend class JSONWriter;
+
 	enum TokenType {
 		TK_CURLY_BRACKET_OPEN,
 		TK_CURLY_BRACKET_CLOSE,
@@ -96,6 +102,125 @@ public:
 	inline String get_error_message() const { return err_str; }
 };
 
+// Pull parser, reads the JSON text in chunks and reports one event at a time,
+// so documents can be processed without holding them in memory.
+class JSONReader : public RefCounted {
+	GDCLASS(JSONReader, RefCounted);
+
+public:
+	enum EventType {
+		EVENT_NONE,
+		EVENT_OBJECT_BEGIN,
+		EVENT_OBJECT_END,
+		EVENT_ARRAY_BEGIN,
+		EVENT_ARRAY_END,
+		EVENT_KEY,
+		EVENT_VALUE,
+	};
+
+private:
+	enum {
+		READ_CHUNK_SIZE = 65536,
+		// Tokens which fail this close to the end of the buffer may be cut short.
+		TOKEN_LOOKAHEAD = 12,
+	};
+
+	struct Container {
+		bool is_object = false;
+		bool need_comma = false;
+		bool at_value = false;
+	};
+
+	Ref<FileAccess> file;
+	Ref<StreamPeer> stream;
+	Vector<uint8_t> source_buffer;
+	int64_t source_pos = 0;
+	bool source_eof = true;
+	// Set by end_stream(), the stream is complete once its available bytes are read.
+	bool stream_ended = false;
+
+	LocalVector<uint8_t> pending_bytes;
+	LocalVector<char32_t> buffer;
+	int buffer_pos = 0;
+	// Start of the event being read. It stays in the buffer until the event is complete,
+	// so it can be read again when more data is needed.
+	int read_start_pos = 0;
+
+	LocalVector<Container> stack;
+	bool root_read = false;
+	bool finished = false;
+	bool failed = false;
+
+	EventType event_type = EVENT_NONE;
+	Variant value;
+	int current_line = 0;
+	String err_str;
+	int err_line = 0;
+
+	void _reset();
+	bool _fill_buffer();
+	Error _next_token(JSON::Token &r_token);
+	Error _read_value(const JSON::Token &p_token);
+	Error _fail(const String &p_message);
+
+protected:
+	static void _bind_methods();
+
+public:
+	Error open(const String &p_path);
+	Error open_file(const Ref<FileAccess> &p_file);
+	Error open_buffer(const Vector<uint8_t> &p_buffer);
+	Error open_stream(const Ref<StreamPeer> &p_stream);
+	void end_stream();
+	void close();
+
+	Error read();
+	EventType get_event_type() const { return event_type; }
+	Variant get_value() const { return value; }
+	int get_depth() const { return stack.size(); }
+	int get_error_line() const { return err_line; }
+	String get_error_message() const { return err_str; }
+};
+
+// Writes JSON text to a file as it is produced, without building the whole document in memory.
+class JSONWriter : public RefCounted {
+	GDCLASS(JSONWriter, RefCounted);
+
+	struct Container {
+		bool is_object = false;
+		bool empty = true;
+		bool at_value = false;
+	};
+
+	Ref<FileAccess> file;
+	String indent;
+	bool sort_keys = true;
+	bool full_precision = false;
+
+	LocalVector<Container> stack;
+	bool root_written = false;
+
+	void _write_separator(Container &p_container);
+	Error _begin_value();
+
+protected:
+	static void _bind_methods();
+
+public:
+	Error open(const String &p_path, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
+	Error open_file(const Ref<FileAccess> &p_file, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
+	Error close();
+
+	Error begin_object();
+	Error end_object();
+	Error begin_array();
+	Error end_array();
+	Error write_key(const String &p_key);
+	Error write_value(const Variant &p_value);
+};
+
+VARIANT_ENUM_CAST(JSONReader::EventType);
+
 class ResourceFormatLoaderJSON : public ResourceFormatLoader {
 public:
 	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override;
@@ -381,6 +381,51 @@ public:
 		return params.result_count_overall;
 	}
 
+	// Culls many segments, traversing the tree once for each packet of up to
+	// BVHCommon::SEGMENT_PACKET_SIZE segments. Fastest when the segments are
+	// close together, e.g. rays cast from the same origin. p_segment_index_array
+	// receives the index of the segment which hit each result.
+	int cull_segments(const POINT *p_from, const POINT *p_to, int p_count, T **p_result_array, int *p_segment_index_array, int p_result_max, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
+		BVH_LOCKED_FUNCTION
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = p_result_max;
+		params.result_array = p_result_array;
+		params.subindex_array = p_subindex_array;
+		params.segment_index_array = p_segment_index_array;
+		params.tester = p_tester;
+		params.tree_collision_mask = p_tree_collision_mask;
+
+		typename BVHABB_CLASS::Segment segments[BVHCommon::SEGMENT_PACKET_SIZE];
+
+		for (int base = 0; base < p_count; base += BVHCommon::SEGMENT_PACKET_SIZE) {
+			if (params.result_count_overall >= p_result_max) {
+				break;
+			}
+
+			int num_segments = MIN(p_count - base, BVHCommon::SEGMENT_PACKET_SIZE);
+			for (int n = 0; n < num_segments; n++) {
+				segments[n].from = p_from[base + n];
+				segments[n].to = p_to[base + n];
+			}
+
+			params.segments = segments;
+			params.num_segments = num_segments;
+
+			tree.cull_segments(params);
+
+			// the tree reports indices within the packet
+			if (p_segment_index_array && base) {
+				for (int n = params.result_count_overall - params.result_count; n < params.result_count_overall; n++) {
+					p_segment_index_array[n] += base;
+				}
+			}
+		}
+
+		return params.result_count_overall;
+	}
+
 	int cull_point(const POINT &p_point, T **p_result_array, int p_result_max, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
 		BVH_LOCKED_FUNCTION
 		typename BVHTREE_CLASS::CullParams params;
@@ -84,6 +84,10 @@ struct BVHCommon {
 	// or use zero for invalid and +1 based indices.
 	static const uint32_t INVALID = (0xffffffff);
 	static const uint32_t INACTIVE = (0xfffffffe);
+
+	// maximum number of segments traversed together in a packet,
+	// one bit each in the active mask
+	static const int SEGMENT_PACKET_SIZE = 32;
 };
 
 // really a handle, can be anything
@@ -30,6 +30,7 @@
 
 #include "worker_thread_pool.h"
 
+#include "core/io/file_access.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
 #include "core/os/thread_safe.h"
@@ -49,6 +50,7 @@ WorkerThreadPool *WorkerThreadPool::singleton = nullptr;
 thread_local CommandQueueMT *WorkerThreadPool::flushing_cmd_queue = nullptr;
 
 void WorkerThreadPool::_process_task(Task *p_task) {
+	LocalVector<Task *> released_tasks; // Dependents that can be posted once this task is done.
 #ifdef THREADS_ENABLED
 	int pool_thread_index = thread_ids[Thread::get_caller_id()];
 	ThreadData &curr_thread = threads[pool_thread_index];
@@ -77,6 +79,15 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		}
 		task_mutex.unlock();
 	}
+
+	TraceEvent trace_event;
+	const bool traced = tracing.is_set();
+	if (traced) {
+		trace_event.description = p_task->description;
+		trace_event.group = p_task->group != nullptr;
+		trace_event.id = p_task->group ? p_task->group->self : p_task->self;
+		trace_event.begin_usec = OS::get_singleton()->get_ticks_usec();
+	}
 #endif
 
 	if (p_task->group) {
@@ -105,13 +116,24 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			}
 		}
 
+#ifdef THREADS_ENABLED
+		// Recorded before the completion is posted, so the event is in the trace once the group is awaited.
+		if (traced) {
+			_record_trace_event(curr_thread, trace_event);
+		}
+#endif
+
 		if (do_post && p_task->template_userdata) {
 			memdelete(p_task->template_userdata); // This is no longer needed at this point, so get rid of it.
 		}
 
 		if (do_post) {
-			p_task->group->done_semaphore.post();
+			// Completion is flagged under the lock, so no dependent can be added after the dependents are released.
+			task_mutex.lock();
 			p_task->group->completed.set_to(true);
+			_release_dependents(p_task->group->dependents, released_tasks);
+			task_mutex.unlock();
+			p_task->group->done_semaphore.post();
 		}
 		uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = p_task->group->finished.increment();
@@ -137,9 +159,16 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			p_task->callable.call();
 		}
 
+#ifdef THREADS_ENABLED
+		if (traced) {
+			_record_trace_event(curr_thread, trace_event);
+		}
+#endif
+
 		task_mutex.lock();
 		p_task->completed = true;
 		p_task->pool_thread_index = -1;
+		_release_dependents(p_task->dependents, released_tasks);
 		if (p_task->waiting_user) {
 			p_task->done_semaphore.post(p_task->waiting_user);
 		}
@@ -170,6 +199,15 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 
 	set_current_thread_safe_for_nodes(safe_for_nodes_backup);
 #endif
+
+	_post_released_tasks(released_tasks);
+}
+
+void WorkerThreadPool::_record_trace_event(ThreadData &p_thread, TraceEvent &p_event) {
+	p_event.end_usec = OS::get_singleton()->get_ticks_usec();
+	MutexLock trace_lock(p_thread.trace_mutex);
+	p_thread.trace_events[p_thread.trace_event_count % TRACE_BUFFER_SIZE] = p_event;
+	p_thread.trace_event_count++;
 }
 
 void WorkerThreadPool::_thread_function(void *p_user) {
@@ -312,11 +350,30 @@ bool WorkerThreadPool::_try_promote_low_priority_task() {
 	}
 }
 
+void WorkerThreadPool::_release_dependents(LocalVector<Task *> &p_dependents, LocalVector<Task *> &r_released_tasks) {
+	for (Task *dependent : p_dependents) {
+		DEV_ASSERT(dependent->pending_dependencies > 0);
+		dependent->pending_dependencies--;
+		if (dependent->pending_dependencies == 0) {
+			r_released_tasks.push_back(dependent);
+		}
+	}
+	p_dependents.clear();
+}
+
+void WorkerThreadPool::_post_released_tasks(const LocalVector<Task *> &p_released_tasks) {
+	// The priority requested when adding each task was kept in it.
+	for (Task *task : p_released_tasks) {
+		task_mutex.lock();
+		_post_tasks_and_unlock(&task, 1, !task->low_priority);
+	}
+}
+
 WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description) {
 	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const TaskID *p_dependencies, uint32_t p_dependency_count) {
 	task_mutex.lock();
 	// Get a free task
 	Task *task = task_allocator.alloc();
@@ -327,9 +384,38 @@ WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable,
 	task->native_func_userdata = p_userdata;
 	task->description = p_description;
 	task->template_userdata = p_template_userdata;
+	task->low_priority = !p_high_priority;
 	tasks.insert(id, task);
 
-	_post_tasks_and_unlock(&task, 1, p_high_priority);
+	uint32_t invalid_dependencies = 0;
+	for (uint32_t i = 0; i < p_dependency_count; i++) {
+		Task **dependencyp = tasks.getptr(p_dependencies[i]);
+		if (dependencyp) {
+			if (!(*dependencyp)->completed) {
+				(*dependencyp)->dependents.push_back(task);
+				task->pending_dependencies++;
+			}
+			continue;
+		}
+		Group **groupp = groups.getptr(p_dependencies[i]);
+		if (groupp) {
+			if (!(*groupp)->completed.is_set()) {
+				(*groupp)->dependents.push_back(task);
+				task->pending_dependencies++;
+			}
+			continue;
+		}
+		invalid_dependencies++;
+	}
+
+	if (task->pending_dependencies > 0) {
+		// Posted by the last dependency to complete.
+		task_mutex.unlock();
+	} else {
+		_post_tasks_and_unlock(&task, 1, p_high_priority);
+	}
+
+	ERR_FAIL_COND_V_MSG(invalid_dependencies > 0, id, vformat("%d invalid task or group ID(s) were ignored as dependencies.", invalid_dependencies));
 
 	return id;
 }
@@ -338,6 +424,14 @@ WorkerThreadPool::TaskID WorkerThreadPool::add_task(const Callable &p_action, bo
 	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description);
 }
 
+WorkerThreadPool::TaskID WorkerThreadPool::add_native_task_with_dependencies(void (*p_func)(void *), void *p_userdata, const TaskID *p_dependencies, uint32_t p_dependency_count, bool p_high_priority, const String &p_description) {
+	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description, p_dependencies, p_dependency_count);
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::add_task_with_dependencies(const Callable &p_action, const PackedInt64Array &p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, p_dependencies.ptr(), p_dependencies.size());
+}
+
 bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
 	task_mutex.lock();
 	const Task *const *taskp = tasks.getptr(p_task_id);
@@ -452,7 +546,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 					}
 				}
 
-				if (singleton->task_queue.first()) {
+				if (task_queue.first()) {
 					task_to_process = task_queue.first()->self();
 					task_queue.remove(task_queue.first());
 				}
@@ -608,6 +702,11 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 			flushing_cmd_queue->lock();
 		}
 
+		// Forget the ID before the group may be freed, so dependencies can't be added to a stale group.
+		task_mutex.lock();
+		groups.erase(p_group);
+		task_mutex.unlock();
+
 		uint32_t max_users = group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = group->finished.increment(); // fetch happens before inc, so increment later.
 
@@ -618,10 +717,6 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 			task_mutex.unlock();
 		}
 	}
-
-	task_mutex.lock(); // This mutex is needed when Physics 2D and/or 3D is selected to run on a separate thread.
-	groups.erase(p_group);
-	task_mutex.unlock();
 #endif
 }
 
@@ -640,6 +735,77 @@ void WorkerThreadPool::thread_exit_command_queue_mt_flush() {
 	flushing_cmd_queue = nullptr;
 }
 
+void WorkerThreadPool::set_tracing_enabled(bool p_enabled) {
+	if (p_enabled && !tracing.is_set()) {
+		// Start a new trace. The buffers are ready before the threads see the flag.
+		trace_frames.resize(TRACE_BUFFER_SIZE);
+		trace_frame_count = 0;
+		for (ThreadData &thread_data : threads) {
+			MutexLock trace_lock(thread_data.trace_mutex);
+			thread_data.trace_events.resize(TRACE_BUFFER_SIZE);
+			thread_data.trace_event_count = 0;
+		}
+	}
+	tracing.set_to(p_enabled);
+}
+
+void WorkerThreadPool::trace_frame() {
+	if (!tracing.is_set()) {
+		return;
+	}
+	trace_frames[trace_frame_count % TRACE_BUFFER_SIZE] = OS::get_singleton()->get_ticks_usec();
+	trace_frame_count++;
+}
+
+Error WorkerThreadPool::save_trace(const String &p_path) const {
+	ERR_FAIL_COND_V_MSG(trace_frames.is_empty(), ERR_UNCONFIGURED, "Tracing was never enabled on the WorkerThreadPool.");
+
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	ERR_FAIL_COND_V_MSG(f.is_null(), ERR_CANT_CREATE, vformat("Cannot save the WorkerThreadPool trace to \"%s\".", p_path));
+
+	// Chrome trace event format, which can also be loaded in Perfetto.
+	f->store_string("{\"traceEvents\":[\n");
+	f->store_string("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"WorkerThreadPool\"}}");
+
+	// The ring buffer wraps around, so write the frames in timestamp order.
+	LocalVector<uint64_t> frames;
+	for (uint32_t i = 0; i < trace_frames.size() && i < trace_frame_count; i++) {
+		frames.push_back(trace_frames[i]);
+	}
+	frames.sort();
+	for (uint64_t frame : frames) {
+		f->store_string(vformat(",\n{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":0,\"ts\":%d}", frame));
+	}
+
+	for (uint32_t i = 0; i < threads.size(); i++) {
+		const ThreadData &thread_data = threads[i];
+		f->store_string(vformat(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"Worker %d\"}}", i + 1, i));
+
+		// The thread may still be recording, so copy its events first.
+		LocalVector<TraceEvent> events;
+		{
+			MutexLock trace_lock(thread_data.trace_mutex);
+			const uint64_t event_count = MIN(thread_data.trace_event_count, (uint64_t)TRACE_BUFFER_SIZE);
+			events.reserve(event_count);
+			for (uint64_t j = thread_data.trace_event_count - event_count; j < thread_data.trace_event_count; j++) {
+				events.push_back(thread_data.trace_events[j % TRACE_BUFFER_SIZE]);
+			}
+		}
+		// Events are recorded when they end, so a task run while waiting comes before the one that waited.
+		events.sort();
+
+		for (const TraceEvent &event : events) {
+			const String name = event.description.is_empty() ? String(event.group ? "Group task" : "Task") : event.description;
+			f->store_string(vformat(",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%d,\"dur\":%d,\"args\":{\"id\":%d}}",
+					name.json_escape(), event.group ? "group" : "task", i + 1, event.begin_usec, event.end_usec - event.begin_usec, event.id));
+		}
+	}
+
+	f->store_string("\n]}\n");
+
+	return OK;
+}
+
 void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio) {
 	ERR_FAIL_COND(threads.size() > 0);
 	if (p_thread_count < 0) {
@@ -652,6 +818,9 @@ void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio)
 
 	for (uint32_t i = 0; i < threads.size(); i++) {
 		threads[i].index = i;
+		if (tracing.is_set()) {
+			threads[i].trace_events.resize(TRACE_BUFFER_SIZE);
+		}
 		threads[i].thread.start(&WorkerThreadPool::_thread_function, &threads[i]);
 		thread_ids.insert(threads[i].thread.get_id(), i);
 	}
@@ -694,6 +863,7 @@ void WorkerThreadPool::finish() {
 
 void WorkerThreadPool::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("add_task", "action", "high_priority", "description"), &WorkerThreadPool::add_task, DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("add_task_with_dependencies", "action", "dependencies", "high_priority", "description"), &WorkerThreadPool::add_task_with_dependencies, DEFVAL(false), DEFVAL(String()));
 	ClassDB::bind_method(D_METHOD("is_task_completed", "task_id"), &WorkerThreadPool::is_task_completed);
 	ClassDB::bind_method(D_METHOD("wait_for_task_completion", "task_id"), &WorkerThreadPool::wait_for_task_completion);
 
@@ -71,6 +71,7 @@ private:
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
+		LocalVector<Task *> dependents; // Tasks waiting for this group to complete before being posted.
 	};
 
 	struct Task {
@@ -90,6 +91,8 @@ private:
 		bool low_priority = false;
 		BaseTemplateUserdata *template_userdata = nullptr;
 		int pool_thread_index = -1;
+		uint32_t pending_dependencies = 0; // Posted once this reaches zero.
+		LocalVector<Task *> dependents; // Tasks waiting for this one to complete before being posted.
 
 		void free_template_userdata();
 		Task() :
@@ -100,6 +103,17 @@ private:
 
 	static const uint32_t TASKS_PAGE_SIZE = 1024;
 	static const uint32_t GROUPS_PAGE_SIZE = 256;
+	static const uint32_t TRACE_BUFFER_SIZE = 16384; // Per thread. When full, the oldest events are overwritten.
+
+	struct TraceEvent {
+		String description;
+		int64_t id = INVALID_TASK_ID; // Task or group ID.
+		bool group = false;
+		uint64_t begin_usec = 0;
+		uint64_t end_usec = 0;
+
+		bool operator<(const TraceEvent &p_other) const { return begin_usec < p_other.begin_usec; }
+	};
 
 	PagedAllocator<Task, false, TASKS_PAGE_SIZE> task_allocator;
 	PagedAllocator<Group, false, GROUPS_PAGE_SIZE> group_allocator;
@@ -120,6 +134,10 @@ private:
 		Task *current_task = nullptr;
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable, or special value (YIELDING).
 		ConditionVariable cond_var;
+		// Only written by this thread. The lock is only contended while the trace is saved.
+		LocalVector<TraceEvent> trace_events;
+		uint64_t trace_event_count = 0;
+		mutable BinaryMutex trace_mutex;
 
 		ThreadData() :
 				ready_for_scripting(false),
@@ -152,20 +170,28 @@ private:
 
 	uint64_t last_task = 1;
 
+	SafeFlag tracing;
+	LocalVector<uint64_t> trace_frames; // Only written by the main thread.
+	uint64_t trace_frame_count = 0;
+
 	static void _thread_function(void *p_user);
 
 	void _process_task(Task *task);
+	void _record_trace_event(ThreadData &p_thread, TraceEvent &p_event);
 
 	void _post_tasks_and_unlock(Task **p_tasks, uint32_t p_count, bool p_high_priority);
 	void _notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count);
 
 	bool _try_promote_low_priority_task();
 
+	void _release_dependents(LocalVector<Task *> &p_dependents, LocalVector<Task *> &r_released_tasks);
+	void _post_released_tasks(const LocalVector<Task *> &p_released_tasks);
+
 	static WorkerThreadPool *singleton;
 
 	static thread_local CommandQueueMT *flushing_cmd_queue;
 
-	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description);
+	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const TaskID *p_dependencies = nullptr, uint32_t p_dependency_count = 0);
 	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
 
 	template <typename C, typename M, typename U>
@@ -206,6 +232,19 @@ public:
 	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String());
 	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
 
+	// Dependent tasks are only posted once all the given tasks and groups are completed, so no thread blocks waiting for them.
+	template <typename C, typename M, typename U>
+	TaskID add_template_task_with_dependencies(C *p_instance, M p_method, U p_userdata, const TaskID *p_dependencies, uint32_t p_dependency_count, bool p_high_priority = false, const String &p_description = String()) {
+		typedef TaskUserData<C, M, U> TUD;
+		TUD *ud = memnew(TUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description, p_dependencies, p_dependency_count);
+	}
+	TaskID add_native_task_with_dependencies(void (*p_func)(void *), void *p_userdata, const TaskID *p_dependencies, uint32_t p_dependency_count, bool p_high_priority = false, const String &p_description = String());
+	TaskID add_task_with_dependencies(const Callable &p_action, const PackedInt64Array &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+
 	bool is_task_completed(TaskID p_task_id) const;
 	Error wait_for_task_completion(TaskID p_task_id);
 
@@ -229,6 +268,11 @@ public:
 
 	_FORCE_INLINE_ int get_thread_count() const { return threads.size(); }
 
+	void set_tracing_enabled(bool p_enabled);
+	_FORCE_INLINE_ bool is_tracing_enabled() const { return tracing.is_set(); }
+	void trace_frame();
+	Error save_trace(const String &p_path) const;
+
 	static WorkerThreadPool *get_singleton() { return singleton; }
 	static int get_thread_index();
 
@@ -248,6 +248,8 @@ void register_core_types() {
 
 	GDREGISTER_CLASS(XMLParser);
 	GDREGISTER_CLASS(JSON);
+	GDREGISTER_CLASS(JSONReader);
+	GDREGISTER_CLASS(JSONWriter);
 
 	GDREGISTER_CLASS(ConfigFile);
 
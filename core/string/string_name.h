@@ -48,7 +48,12 @@ class StringName {
 	enum {
 		STRING_TABLE_BITS = 16,
 		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_MASK = STRING_TABLE_LEN - 1,
+		// Each bucket is guarded by one of these mutexes, so threads
+		// looking up unrelated names don't contend for a single lock.
+		STRING_TABLE_MUTEX_BITS = 6,
+		STRING_TABLE_MUTEX_LEN = 1 << STRING_TABLE_MUTEX_BITS,
+		STRING_TABLE_MUTEX_MASK = STRING_TABLE_MUTEX_LEN - 1
 	};
 
 	struct _Data {
@@ -76,6 +81,8 @@ class StringName {
 	friend void unregister_core_types();
 	friend class Main;
 	static Mutex mutex;
+	static Mutex table_mutexes[STRING_TABLE_MUTEX_LEN];
+	static _FORCE_INLINE_ Mutex &_get_table_mutex(uint32_t p_idx) { return table_mutexes[p_idx & STRING_TABLE_MUTEX_MASK]; }
 	static void setup();
 	static void cleanup();
 	static bool configured;
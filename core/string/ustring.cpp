@@ -1844,6 +1844,37 @@ String String::utf8(const char *p_utf8, int p_len) {
 	return ret;
 }
 
+// Checks 8 bytes at once for a run of ASCII without NUL (nor CR, if skipped).
+static _FORCE_INLINE_ bool _is_ascii_block(const char *p_ptr, bool p_skip_cr) {
+	const uint64_t high_bits = 0x8080808080808080;
+	const uint64_t low_bits = 0x0101010101010101;
+
+	uint64_t block;
+	memcpy(&block, p_ptr, sizeof(block));
+	if (block & high_bits) {
+		return false;
+	}
+	if ((block - low_bits) & ~block & high_bits) {
+		return false; // Has a zero byte.
+	}
+	if (p_skip_cr) {
+		const uint64_t cr = block ^ (low_bits * '\r');
+		if ((cr - low_bits) & ~cr & high_bits) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Checks 8 characters at once for a run of ASCII.
+static _FORCE_INLINE_ bool _is_ascii_block(const char32_t *p_ptr) {
+	uint32_t bits = 0;
+	for (int i = 0; i < 8; i++) {
+		bits |= p_ptr[i];
+	}
+	return bits <= 0x7f;
+}
+
 Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 	if (!p_utf8) {
 		return ERR_INVALID_DATA;
@@ -1874,6 +1905,14 @@ Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 		int skip = 0;
 		uint8_t c_start = 0;
 		while (ptrtmp != ptrtmp_limit && *ptrtmp) {
+			// Fast path for runs of ASCII, only when the length is known, so the block can't be read past the end.
+			if (skip == 0 && ptrtmp_limit && ptrtmp_limit - ptrtmp >= 8 && _is_ascii_block(ptrtmp, p_skip_cr)) {
+				ptrtmp += 8;
+				cstr_size += 8;
+				str_size += 8;
+				continue;
+			}
+
 #if CHAR_MIN == 0
 			uint8_t c = *ptrtmp;
 #else
@@ -1946,6 +1985,17 @@ Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 	int skip = 0;
 	uint32_t unichar = 0;
 	while (cstr_size) {
+		// Fast path for runs of ASCII, all the counted bytes are before the terminator.
+		if (skip == 0 && cstr_size >= 8 && _is_ascii_block(p_utf8, p_skip_cr)) {
+			for (int i = 0; i < 8; i++) {
+				dst[i] = (uint8_t)p_utf8[i];
+			}
+			dst += 8;
+			p_utf8 += 8;
+			cstr_size -= 8;
+			continue;
+		}
+
 #if CHAR_MIN == 0
 		uint8_t c = *p_utf8;
 #else
@@ -2033,6 +2083,12 @@ CharString String::utf8() const {
 	const char32_t *d = &operator[](0);
 	int fl = 0;
 	for (int i = 0; i < l; i++) {
+		if (i + 8 <= l && _is_ascii_block(&d[i])) { // Fast path for runs of ASCII.
+			fl += 8;
+			i += 7;
+			continue;
+		}
+
 		uint32_t c = d[i];
 		if (c <= 0x7f) { // 7 bits.
 			fl += 1;
@@ -2065,6 +2121,14 @@ CharString String::utf8() const {
 #define APPEND_CHAR(m_c) *(cdst++) = m_c
 
 	for (int i = 0; i < l; i++) {
+		if (i + 8 <= l && _is_ascii_block(&d[i])) { // Fast path for runs of ASCII.
+			for (int j = 0; j < 8; j++) {
+				APPEND_CHAR(d[i + j]);
+			}
+			i += 7;
+			continue;
+		}
+
 		uint32_t c = d[i];
 
 		if (c <= 0x7f) { // 7 bits.
@@ -3061,8 +3125,14 @@ int String::find(const String &p_str, int p_from) const {
 
 	const char32_t *src = get_data();
 	const char32_t *str = p_str.get_data();
+	const char32_t first = str[0];
 
 	for (int i = p_from; i <= (len - src_len); i++) {
+		// Only compare the rest where the first character matches.
+		if (src[i] != first) {
+			continue;
+		}
+
 		bool found = true;
 		for (int j = 0; j < src_len; j++) {
 			int read_pos = i + j;
@@ -0,0 +1,722 @@
+/**************************************************************************/
+/*  ordered_hash_map.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef ORDERED_HASH_MAP_H
+#define ORDERED_HASH_MAP_H
+
+#include "core/math/math_funcs.h"
+#include "core/os/memory.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/pair.h"
+
+/**
+ * A HashMap variant that keeps its entries densely packed in insertion order.
+ *
+ * Entries are appended to a list of chunks whose size doubles with each new
+ * chunk, and an open-addressed index (Robin Hood hashing with backward shift
+ * deletion, like HashMap) points into them. Compared to HashMap there is no
+ * per-element allocation and no linked list, so iteration walks contiguous
+ * memory and clearing or copying does not touch the allocator for each element.
+ *
+ * Erasing never moves the remaining entries, it leaves a hole in the entry list
+ * which iteration skips. Inserting doesn't move entries either, unless holes
+ * outnumber the live entries: then they are compacted away first, which moves
+ * entries and invalidates pointers and iterators.
+ */
+
+template <typename TKey, typename TValue>
+struct OrderedHashMapEntry {
+	uint32_t hash = 0; // EMPTY_HASH once erased.
+	uint32_t chunk = 0;
+	KeyValue<TKey, TValue> data;
+
+	OrderedHashMapEntry(uint32_t p_hash, uint32_t p_chunk, const TKey &p_key, const TValue &p_value) :
+			hash(p_hash),
+			chunk(p_chunk),
+			data(p_key, p_value) {}
+};
+
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class OrderedHashMap {
+public:
+	static constexpr uint32_t MIN_CAPACITY_INDEX = 2; // Use a prime.
+	static constexpr float MAX_OCCUPANCY = 0.75;
+	static constexpr uint32_t EMPTY_HASH = 0;
+	static constexpr uint32_t MIN_CHUNK_SIZE = 4;
+	static constexpr uint32_t MAX_CHUNKS = 28;
+
+private:
+	typedef OrderedHashMapEntry<TKey, TValue> Entry;
+
+	Entry *chunks[MAX_CHUNKS] = {};
+	Entry **elements = nullptr;
+	uint32_t *hashes = nullptr;
+	uint32_t capacity_index = 0;
+	uint32_t num_elements = 0;
+	// Position where the next entry is appended.
+	uint32_t tail_chunk = 0;
+	uint32_t tail_offset = 0;
+
+	static _FORCE_INLINE_ uint32_t _get_chunk_size(uint32_t p_chunk) {
+		return MIN_CHUNK_SIZE << p_chunk;
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_chunk_start(uint32_t p_chunk) {
+		return MIN_CHUNK_SIZE * ((1u << p_chunk) - 1);
+	}
+
+	// Number of entries in use, including erased ones.
+	_FORCE_INLINE_ uint32_t _get_used() const {
+		return _get_chunk_start(tail_chunk) + tail_offset;
+	}
+
+	_FORCE_INLINE_ uint32_t _hash(const TKey &p_key) const {
+		uint32_t hash = Hasher::hash(p_key);
+
+		if (unlikely(hash == EMPTY_HASH)) {
+			hash = EMPTY_HASH + 1;
+		}
+
+		return hash;
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_probe_length(const uint32_t p_pos, const uint32_t p_hash, const uint32_t p_capacity, const uint64_t p_capacity_inv) {
+		const uint32_t original_pos = fastmod(p_hash, p_capacity_inv, p_capacity);
+		return fastmod(p_pos - original_pos + p_capacity, p_capacity_inv, p_capacity);
+	}
+
+	bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
+		if (elements == nullptr || num_elements == 0) {
+			return false; // Failed lookups, no elements
+		}
+
+		const uint32_t capacity = hash_table_size_primes[capacity_index];
+		const uint64_t capacity_inv = hash_table_size_primes_inv[capacity_index];
+		uint32_t hash = _hash(p_key);
+		uint32_t pos = fastmod(hash, capacity_inv, capacity);
+		uint32_t distance = 0;
+
+		while (true) {
+			if (hashes[pos] == EMPTY_HASH) {
+				return false;
+			}
+
+			if (distance > _get_probe_length(pos, hashes[pos], capacity, capacity_inv)) {
+				return false;
+			}
+
+			if (hashes[pos] == hash && Comparator::compare(elements[pos]->data.key, p_key)) {
+				r_pos = pos;
+				return true;
+			}
+
+			pos = fastmod((pos + 1), capacity_inv, capacity);
+			distance++;
+		}
+	}
+
+	void _insert_with_hash(uint32_t p_hash, Entry *p_entry) {
+		const uint32_t capacity = hash_table_size_primes[capacity_index];
+		const uint64_t capacity_inv = hash_table_size_primes_inv[capacity_index];
+		uint32_t hash = p_hash;
+		Entry *entry = p_entry;
+		uint32_t distance = 0;
+		uint32_t pos = fastmod(hash, capacity_inv, capacity);
+
+		while (true) {
+			if (hashes[pos] == EMPTY_HASH) {
+				elements[pos] = entry;
+				hashes[pos] = hash;
+
+				num_elements++;
+
+				return;
+			}
+
+			// Not an empty slot, let's check the probing length of the existing one.
+			uint32_t existing_probe_len = _get_probe_length(pos, hashes[pos], capacity, capacity_inv);
+			if (existing_probe_len < distance) {
+				SWAP(hash, hashes[pos]);
+				SWAP(entry, elements[pos]);
+				distance = existing_probe_len;
+			}
+
+			pos = fastmod((pos + 1), capacity_inv, capacity);
+			distance++;
+		}
+	}
+
+	void _allocate_index() {
+		uint32_t capacity = hash_table_size_primes[capacity_index];
+		hashes = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * capacity));
+		elements = reinterpret_cast<Entry **>(Memory::alloc_static(sizeof(Entry *) * capacity));
+
+		for (uint32_t i = 0; i < capacity; i++) {
+			hashes[i] = EMPTY_HASH;
+			elements[i] = nullptr;
+		}
+	}
+
+	// Re-inserts every live entry into the index, which must already be allocated.
+	void _rebuild_index() {
+		uint32_t capacity = hash_table_size_primes[capacity_index];
+		for (uint32_t i = 0; i < capacity; i++) {
+			hashes[i] = EMPTY_HASH;
+			elements[i] = nullptr;
+		}
+
+		num_elements = 0;
+		for (Entry *E = _next_live(0, 0); E; E = _next_entry(E)) {
+			_insert_with_hash(E->hash, E);
+		}
+	}
+
+	void _resize_and_rehash(uint32_t p_new_capacity_index) {
+		// Capacity can't be 0.
+		capacity_index = MAX((uint32_t)MIN_CAPACITY_INDEX, p_new_capacity_index);
+
+		if (elements != nullptr) {
+			Memory::free_static(elements);
+			Memory::free_static(hashes);
+		}
+		_allocate_index();
+		_rebuild_index();
+	}
+
+	Entry *_append(uint32_t p_hash, const TKey &p_key, const TValue &p_value) {
+		if (tail_offset == _get_chunk_size(tail_chunk)) {
+			ERR_FAIL_COND_V_MSG(tail_chunk + 1 == MAX_CHUNKS, nullptr, "Ordered hash map maximum size reached, aborting insertion.");
+			tail_chunk++;
+			tail_offset = 0;
+		}
+
+		if (chunks[tail_chunk] == nullptr) {
+			chunks[tail_chunk] = reinterpret_cast<Entry *>(Memory::alloc_static(sizeof(Entry) * _get_chunk_size(tail_chunk)));
+		}
+
+		Entry *entry = &chunks[tail_chunk][tail_offset++];
+		memnew_placement(entry, Entry(p_hash, tail_chunk, p_key, p_value));
+		return entry;
+	}
+
+	// Returns the first live entry at or after the given position.
+	Entry *_next_live(uint32_t p_chunk, uint32_t p_offset) const {
+		while (p_chunk <= tail_chunk) {
+			Entry *chunk = chunks[p_chunk];
+			const uint32_t end = p_chunk == tail_chunk ? tail_offset : _get_chunk_size(p_chunk);
+
+			for (; p_offset < end; p_offset++) {
+				if (chunk[p_offset].hash != EMPTY_HASH) {
+					return &chunk[p_offset];
+				}
+			}
+
+			p_chunk++;
+			p_offset = 0;
+		}
+
+		return nullptr;
+	}
+
+	// Returns the last live entry before the given position.
+	Entry *_prev_live(uint32_t p_chunk, uint32_t p_offset) const {
+		while (p_chunk > 0 || p_offset > 0) {
+			if (p_offset == 0) {
+				p_chunk--;
+				p_offset = _get_chunk_size(p_chunk);
+			}
+			p_offset--;
+
+			Entry *entry = &chunks[p_chunk][p_offset];
+			if (entry->hash != EMPTY_HASH) {
+				return entry;
+			}
+		}
+
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ Entry *_next_entry(const Entry *p_entry) const {
+		const uint32_t chunk = p_entry->chunk;
+		const uint32_t offset = p_entry - chunks[chunk] + 1;
+		const uint32_t end = chunk == tail_chunk ? tail_offset : _get_chunk_size(chunk);
+		if (likely(offset < end && p_entry[1].hash != EMPTY_HASH)) {
+			return const_cast<Entry *>(p_entry + 1);
+		}
+		return _next_live(chunk, offset);
+	}
+
+	_FORCE_INLINE_ Entry *_prev_entry(const Entry *p_entry) const {
+		return _prev_live(p_entry->chunk, p_entry - chunks[p_entry->chunk]);
+	}
+
+	// Drops erased entries from the end of the list.
+	void _trim_tail() {
+		while (tail_chunk > 0 || tail_offset > 0) {
+			if (tail_offset == 0) {
+				tail_chunk--;
+				tail_offset = _get_chunk_size(tail_chunk);
+			}
+
+			if (chunks[tail_chunk][tail_offset - 1].hash != EMPTY_HASH) {
+				return;
+			}
+			tail_offset--;
+		}
+	}
+
+	// Points the index slot of a relocated entry to its new address.
+	void _update_index(const Entry *p_old, Entry *p_new) {
+		const uint32_t capacity = hash_table_size_primes[capacity_index];
+		const uint64_t capacity_inv = hash_table_size_primes_inv[capacity_index];
+		uint32_t pos = fastmod(p_new->hash, capacity_inv, capacity);
+
+		while (elements[pos] != p_old) {
+			pos = fastmod((pos + 1), capacity_inv, capacity);
+		}
+		elements[pos] = p_new;
+	}
+
+	// Moves live entries over the erased ones, keeping their order.
+	void _compact() {
+		const uint32_t used = _get_used();
+		uint32_t read_chunk = 0;
+		uint32_t read_offset = 0;
+		uint32_t write_chunk = 0;
+		uint32_t write_offset = 0;
+
+		for (uint32_t i = 0; i < used; i++) {
+			if (read_offset == _get_chunk_size(read_chunk)) {
+				read_chunk++;
+				read_offset = 0;
+			}
+
+			Entry *src = &chunks[read_chunk][read_offset++];
+			if (src->hash == EMPTY_HASH) {
+				continue;
+			}
+
+			if (write_offset == _get_chunk_size(write_chunk)) {
+				write_chunk++;
+				write_offset = 0;
+			}
+
+			Entry *dst = &chunks[write_chunk][write_offset++];
+			if (dst != src) {
+				// Entries are relocated bitwise, like CowData does when reallocating.
+				memcpy((void *)dst, (const void *)src, sizeof(Entry));
+				dst->chunk = write_chunk;
+				src->hash = EMPTY_HASH;
+				_update_index(src, dst);
+			}
+		}
+
+		tail_chunk = write_chunk;
+		tail_offset = write_offset;
+	}
+
+	Entry *_insert(const TKey &p_key, const TValue &p_value) {
+		uint32_t capacity = hash_table_size_primes[capacity_index];
+		if (unlikely(elements == nullptr)) {
+			// Allocate on demand to save memory.
+			_allocate_index();
+		}
+
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+
+		if (exists) {
+			elements[pos]->data.value = p_value;
+			return elements[pos];
+		} else {
+			const uint32_t erased = _get_used() - num_elements;
+			if (erased > num_elements && erased >= MIN_CHUNK_SIZE) {
+				_compact();
+			}
+
+			if (num_elements + 1 > MAX_OCCUPANCY * capacity) {
+				ERR_FAIL_COND_V_MSG(capacity_index + 1 == HASH_TABLE_SIZE_MAX, nullptr, "Hash table maximum capacity reached, aborting insertion.");
+				_resize_and_rehash(capacity_index + 1);
+			}
+
+			uint32_t hash = _hash(p_key);
+			Entry *entry = _append(hash, p_key, p_value);
+			ERR_FAIL_NULL_V(entry, nullptr);
+			_insert_with_hash(hash, entry);
+			return entry;
+		}
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return hash_table_size_primes[capacity_index]; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (elements == nullptr || _get_used() == 0) {
+			return;
+		}
+
+		for (Entry *E = _next_live(0, 0); E; E = _next_entry(E)) {
+			E->~Entry();
+		}
+
+		uint32_t capacity = hash_table_size_primes[capacity_index];
+		for (uint32_t i = 0; i < capacity; i++) {
+			hashes[i] = EMPTY_HASH;
+			elements[i] = nullptr;
+		}
+
+		tail_chunk = 0;
+		tail_offset = 0;
+		num_elements = 0;
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "OrderedHashMap key not found.");
+		return elements[pos]->data.value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "OrderedHashMap key not found.");
+		return elements[pos]->data.value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+
+		if (exists) {
+			return &elements[pos]->data.value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+
+		if (exists) {
+			return &elements[pos]->data.value;
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		uint32_t _pos = 0;
+		return _lookup_pos(p_key, _pos);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+
+		if (!exists) {
+			return false;
+		}
+
+		Entry *entry = elements[pos];
+
+		const uint32_t capacity = hash_table_size_primes[capacity_index];
+		const uint64_t capacity_inv = hash_table_size_primes_inv[capacity_index];
+		uint32_t next_pos = fastmod((pos + 1), capacity_inv, capacity);
+		while (hashes[next_pos] != EMPTY_HASH && _get_probe_length(next_pos, hashes[next_pos], capacity, capacity_inv) != 0) {
+			SWAP(hashes[next_pos], hashes[pos]);
+			SWAP(elements[next_pos], elements[pos]);
+			pos = next_pos;
+			next_pos = fastmod((pos + 1), capacity_inv, capacity);
+		}
+
+		hashes[pos] = EMPTY_HASH;
+		elements[pos] = nullptr;
+		num_elements--;
+
+		entry->~Entry();
+		entry->hash = EMPTY_HASH;
+
+		_trim_tail();
+
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	// If adding a known (possibly large) number of elements at once, must be larger than old capacity.
+	void reserve(uint32_t p_new_capacity) {
+		uint32_t new_index = capacity_index;
+
+		while (hash_table_size_primes[new_index] < p_new_capacity) {
+			ERR_FAIL_COND_MSG(new_index + 1 == (uint32_t)HASH_TABLE_SIZE_MAX, nullptr);
+			new_index++;
+		}
+
+		if (new_index == capacity_index) {
+			return;
+		}
+
+		if (elements == nullptr) {
+			capacity_index = new_index;
+			return; // Unallocated yet.
+		}
+		_resize_and_rehash(new_index);
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> &operator*() const {
+			return E->data;
+		}
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> *operator->() const { return &E->data; }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			if (E) {
+				E = map->_next_entry(E);
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ ConstIterator &operator--() {
+			if (E) {
+				E = map->_prev_entry(E);
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return E == b.E; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return E != b.E; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return E != nullptr;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const OrderedHashMap *p_map, const Entry *p_E) {
+			map = p_map;
+			E = p_E;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+		_FORCE_INLINE_ ConstIterator(const ConstIterator &p_it) {
+			map = p_it.map;
+			E = p_it.E;
+		}
+		_FORCE_INLINE_ void operator=(const ConstIterator &p_it) {
+			map = p_it.map;
+			E = p_it.E;
+		}
+
+	private:
+		const OrderedHashMap *map = nullptr;
+		const Entry *E = nullptr;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ KeyValue<TKey, TValue> &operator*() const {
+			return E->data;
+		}
+		_FORCE_INLINE_ KeyValue<TKey, TValue> *operator->() const { return &E->data; }
+		_FORCE_INLINE_ Iterator &operator++() {
+			if (E) {
+				E = map->_next_entry(E);
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ Iterator &operator--() {
+			if (E) {
+				E = map->_prev_entry(E);
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return E == b.E; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return E != b.E; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return E != nullptr;
+		}
+
+		_FORCE_INLINE_ Iterator(const OrderedHashMap *p_map, Entry *p_E) {
+			map = p_map;
+			E = p_E;
+		}
+		_FORCE_INLINE_ Iterator() {}
+		_FORCE_INLINE_ Iterator(const Iterator &p_it) {
+			map = p_it.map;
+			E = p_it.E;
+		}
+		_FORCE_INLINE_ void operator=(const Iterator &p_it) {
+			map = p_it.map;
+			E = p_it.E;
+		}
+
+		operator ConstIterator() const {
+			return ConstIterator(map, E);
+		}
+
+	private:
+		const OrderedHashMap *map = nullptr;
+		Entry *E = nullptr;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(this, _next_live(0, 0));
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(this, nullptr);
+	}
+	_FORCE_INLINE_ Iterator last() {
+		return Iterator(this, _prev_live(tail_chunk, tail_offset));
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		if (!exists) {
+			return end();
+		}
+		return Iterator(this, elements[pos]);
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(this, _next_live(0, 0));
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(this, nullptr);
+	}
+	_FORCE_INLINE_ ConstIterator last() const {
+		return ConstIterator(this, _prev_live(tail_chunk, tail_offset));
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		if (!exists) {
+			return end();
+		}
+		return ConstIterator(this, elements[pos]);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND(!exists);
+		return elements[pos]->data.value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		if (!exists) {
+			return _insert(p_key, TValue())->data.value;
+		} else {
+			return elements[pos]->data.value;
+		}
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		return Iterator(this, _insert(p_key, p_value));
+	}
+
+	/* Constructors */
+
+	OrderedHashMap(const OrderedHashMap &p_other) {
+		reserve(hash_table_size_primes[p_other.capacity_index]);
+
+		if (p_other.num_elements == 0) {
+			return;
+		}
+
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	void operator=(const OrderedHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		if (num_elements != 0) {
+			clear();
+		}
+
+		reserve(hash_table_size_primes[p_other.capacity_index]);
+
+		if (p_other.elements == nullptr) {
+			return; // Nothing to copy.
+		}
+
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	OrderedHashMap(uint32_t p_initial_capacity) {
+		// Capacity can't be 0.
+		capacity_index = 0;
+		reserve(p_initial_capacity);
+	}
+	OrderedHashMap() {
+		capacity_index = MIN_CAPACITY_INDEX;
+	}
+
+	~OrderedHashMap() {
+		clear();
+
+		for (uint32_t i = 0; i < MAX_CHUNKS; i++) {
+			if (chunks[i] != nullptr) {
+				Memory::free_static(chunks[i]);
+			}
+		}
+
+		if (elements != nullptr) {
+			Memory::free_static(elements);
+			Memory::free_static(hashes);
+		}
+	}
+};
+
+#endif // ORDERED_HASH_MAP_H
@@ -36,6 +36,7 @@
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
@@ -69,62 +70,94 @@ public:
 
 template <typename T, bool THREAD_SAFE = false>
 class RID_Alloc : public RID_AllocBase {
-	T **chunks = nullptr;
+	// The chunk tables are never resized in place. When they grow, the old
+	// tables are kept alive until destruction, so get_or_null() and owns()
+	// can read them without taking the lock.
+	SafeNumeric<T **> chunks;
+	SafeNumeric<SafeNumeric<uint32_t> **> validator_chunks;
 	uint32_t **free_list_chunks = nullptr;
-	uint32_t **validator_chunks = nullptr;
+	uint32_t chunk_capacity = 0;
+	LocalVector<void *> retired_chunk_tables;
 
 	uint32_t elements_in_chunk;
-	uint32_t max_alloc = 0;
+	SafeNumeric<uint32_t> max_alloc;
 	uint32_t alloc_count = 0;
 
 	const char *description = nullptr;
 
 	mutable SpinLock spin_lock;
 
+	_FORCE_INLINE_ SafeNumeric<uint32_t> &_get_validator(uint32_t p_idx) const {
+		return validator_chunks.get()[p_idx / elements_in_chunk][p_idx % elements_in_chunk];
+	}
+
+	void _grow_chunk_tables() {
+		uint32_t new_capacity = chunk_capacity == 0 ? 1 : chunk_capacity * 2;
+
+		T **new_chunks = (T **)memalloc(sizeof(T *) * new_capacity);
+		SafeNumeric<uint32_t> **new_validator_chunks = (SafeNumeric<uint32_t> **)memalloc(sizeof(SafeNumeric<uint32_t> *) * new_capacity);
+		if (chunk_capacity) {
+			memcpy(new_chunks, chunks.get(), sizeof(T *) * chunk_capacity);
+			memcpy(new_validator_chunks, validator_chunks.get(), sizeof(SafeNumeric<uint32_t> *) * chunk_capacity);
+
+			if (THREAD_SAFE) {
+				// Other threads may still be reading these.
+				retired_chunk_tables.push_back(chunks.get());
+				retired_chunk_tables.push_back(validator_chunks.get());
+			} else {
+				memfree(chunks.get());
+				memfree(validator_chunks.get());
+			}
+		}
+
+		// Only used with the lock held.
+		free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * new_capacity);
+
+		chunks.set(new_chunks);
+		validator_chunks.set(new_validator_chunks);
+		chunk_capacity = new_capacity;
+	}
+
 	_FORCE_INLINE_ RID _allocate_rid() {
 		if (THREAD_SAFE) {
 			spin_lock.lock();
 		}
 
-		if (alloc_count == max_alloc) {
+		if (alloc_count == max_alloc.get()) {
 			//allocate a new chunk
-			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
+			uint32_t chunk_count = max_alloc.get() / elements_in_chunk;
 
 			//grow chunks
-			chunks = (T **)memrealloc(chunks, sizeof(T *) * (chunk_count + 1));
-			chunks[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); //but don't initialize
+			if (chunk_count == chunk_capacity) {
+				_grow_chunk_tables();
+			}
+			chunks.get()[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); //but don't initialize
 
 			//grow validators
-			validator_chunks = (uint32_t **)memrealloc(validator_chunks, sizeof(uint32_t *) * (chunk_count + 1));
-			validator_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
+			validator_chunks.get()[chunk_count] = (SafeNumeric<uint32_t> *)memalloc(sizeof(SafeNumeric<uint32_t>) * elements_in_chunk);
 			//grow free lists
-			free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
 			free_list_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
 
 			//initialize
 			for (uint32_t i = 0; i < elements_in_chunk; i++) {
 				// Don't initialize chunk.
-				validator_chunks[chunk_count][i] = 0xFFFFFFFF;
+				memnew_placement(&validator_chunks.get()[chunk_count][i], SafeNumeric<uint32_t>(0xFFFFFFFF));
 				free_list_chunks[chunk_count][i] = alloc_count + i;
 			}
 
-			max_alloc += elements_in_chunk;
+			// Publishes the new chunk to the lock-free lookups.
+			max_alloc.set(max_alloc.get() + elements_in_chunk);
 		}
 
 		uint32_t free_index = free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk];
 
-		uint32_t free_chunk = free_index / elements_in_chunk;
-		uint32_t free_element = free_index % elements_in_chunk;
-
 		uint32_t validator = (uint32_t)(_gen_id() & 0x7FFFFFFF);
 		CRASH_COND_MSG(validator == 0x7FFFFFFF, "Overflow in RID validator");
 		uint64_t id = validator;
 		id <<= 32;
 		id |= free_index;
 
-		validator_chunks[free_chunk][free_element] = validator;
-
-		validator_chunks[free_chunk][free_element] |= 0x80000000; //mark uninitialized bit
+		_get_validator(free_index).set(validator | 0x80000000); //mark uninitialized bit
 
 		alloc_count++;
 
@@ -135,6 +168,48 @@ class RID_Alloc : public RID_AllocBase {
 		return _make_from_id(id);
 	}
 
+	T *_get_for_initialize(const RID &p_rid) {
+		if (THREAD_SAFE) {
+			spin_lock.lock();
+		}
+
+		uint64_t id = p_rid.get_id();
+		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
+		if (unlikely(idx >= max_alloc.get())) {
+			if (THREAD_SAFE) {
+				spin_lock.unlock();
+			}
+			return nullptr;
+		}
+
+		uint32_t validator = uint32_t(id >> 32);
+		SafeNumeric<uint32_t> &current = _get_validator(idx);
+
+		if (unlikely(!(current.get() & 0x80000000))) {
+			if (THREAD_SAFE) {
+				spin_lock.unlock();
+			}
+			ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
+		}
+
+		if (unlikely((current.get() & 0x7FFFFFFF) != validator)) {
+			if (THREAD_SAFE) {
+				spin_lock.unlock();
+			}
+			ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
+		}
+
+		current.set(validator); //initialized
+
+		T *ptr = &chunks.get()[idx / elements_in_chunk][idx % elements_in_chunk];
+
+		if (THREAD_SAFE) {
+			spin_lock.unlock();
+		}
+
+		return ptr;
+	}
+
 public:
 	RID make_rid() {
 		RID rid = _allocate_rid();
@@ -152,20 +227,19 @@ public:
 		return _allocate_rid();
 	}
 
+	// Doesn't lock, the validator is checked atomically instead.
 	_FORCE_INLINE_ T *get_or_null(const RID &p_rid, bool p_initialize = false) {
 		if (p_rid == RID()) {
 			return nullptr;
 		}
-		if (THREAD_SAFE) {
-			spin_lock.lock();
+
+		if (unlikely(p_initialize)) {
+			return _get_for_initialize(p_rid);
 		}
 
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		if (unlikely(idx >= max_alloc.get())) {
 			return nullptr;
 		}
 
@@ -173,41 +247,16 @@ public:
 		uint32_t idx_element = idx % elements_in_chunk;
 
 		uint32_t validator = uint32_t(id >> 32);
+		uint32_t current = validator_chunks.get()[idx_chunk][idx_element].get();
 
-		if (unlikely(p_initialize)) {
-			if (unlikely(!(validator_chunks[idx_chunk][idx_element] & 0x80000000))) {
-				if (THREAD_SAFE) {
-					spin_lock.unlock();
-				}
-				ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
-			}
-
-			if (unlikely((validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) != validator)) {
-				if (THREAD_SAFE) {
-					spin_lock.unlock();
-				}
-				ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
-			}
-
-			validator_chunks[idx_chunk][idx_element] &= 0x7FFFFFFF; //initialized
-
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
-			if ((validator_chunks[idx_chunk][idx_element] & 0x80000000) && validator_chunks[idx_chunk][idx_element] != 0xFFFFFFFF) {
+		if (unlikely(current != validator)) {
+			if ((current & 0x80000000) && current != 0xFFFFFFFF) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
 			}
 			return nullptr;
 		}
 
-		T *ptr = &chunks[idx_chunk][idx_element];
-
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return ptr;
+		return &chunks.get()[idx_chunk][idx_element];
 	}
 	void initialize_rid(RID p_rid) {
 		T *mem = get_or_null(p_rid, true);
@@ -221,31 +270,15 @@ public:
 	}
 
 	_FORCE_INLINE_ bool owns(const RID &p_rid) const {
-		if (THREAD_SAFE) {
-			spin_lock.lock();
-		}
-
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		if (unlikely(idx >= max_alloc.get())) {
 			return false;
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
 		uint32_t validator = uint32_t(id >> 32);
 
-		bool owned = (validator != 0x7FFFFFFF) && (validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) == validator;
-
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return owned;
+		return (validator != 0x7FFFFFFF) && (_get_validator(idx).get() & 0x7FFFFFFF) == validator;
 	}
 
 	_FORCE_INLINE_ void free(const RID &p_rid) {
@@ -255,7 +288,7 @@ public:
 
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
+		if (unlikely(idx >= max_alloc.get())) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
@@ -266,20 +299,22 @@ public:
 		uint32_t idx_element = idx % elements_in_chunk;
 
 		uint32_t validator = uint32_t(id >> 32);
-		if (unlikely(validator_chunks[idx_chunk][idx_element] & 0x80000000)) {
+		SafeNumeric<uint32_t> &current = validator_chunks.get()[idx_chunk][idx_element];
+		if (unlikely(current.get() & 0x80000000)) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID.");
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
+		} else if (unlikely(current.get() != validator)) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL();
 		}
 
-		chunks[idx_chunk][idx_element].~T();
-		validator_chunks[idx_chunk][idx_element] = 0xFFFFFFFF; // go invalid
+		// Go invalid before destroying, so lock-free lookups can't return the destroyed object.
+		current.set(0xFFFFFFFF);
+		chunks.get()[idx_chunk][idx_element].~T();
 
 		alloc_count--;
 		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
@@ -296,8 +331,8 @@ public:
 		if (THREAD_SAFE) {
 			spin_lock.lock();
 		}
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+		for (size_t i = 0; i < max_alloc.get(); i++) {
+			uint64_t validator = _get_validator(i).get();
 			if (validator != 0xFFFFFFFF) {
 				p_owned->push_back(_make_from_id((validator << 32) | i));
 			}
@@ -313,8 +348,8 @@ public:
 			spin_lock.lock();
 		}
 		uint32_t idx = 0;
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+		for (size_t i = 0; i < max_alloc.get(); i++) {
+			uint64_t validator = _get_validator(i).get();
 			if (validator != 0xFFFFFFFF) {
 				p_rid_buffer[idx] = _make_from_id((validator << 32) | i);
 				idx++;
@@ -338,28 +373,32 @@ public:
 			print_error(vformat("ERROR: %d RID allocations of type '%s' were leaked at exit.",
 					alloc_count, description ? description : typeid(T).name()));
 
-			for (size_t i = 0; i < max_alloc; i++) {
-				uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+			for (size_t i = 0; i < max_alloc.get(); i++) {
+				uint64_t validator = _get_validator(i).get();
 				if (validator & 0x80000000) {
 					continue; //uninitialized
 				}
 				if (validator != 0xFFFFFFFF) {
-					chunks[i / elements_in_chunk][i % elements_in_chunk].~T();
+					chunks.get()[i / elements_in_chunk][i % elements_in_chunk].~T();
 				}
 			}
 		}
 
-		uint32_t chunk_count = max_alloc / elements_in_chunk;
+		uint32_t chunk_count = max_alloc.get() / elements_in_chunk;
 		for (uint32_t i = 0; i < chunk_count; i++) {
-			memfree(chunks[i]);
-			memfree(validator_chunks[i]);
+			memfree(chunks.get()[i]);
+			memfree(validator_chunks.get()[i]);
 			memfree(free_list_chunks[i]);
 		}
 
-		if (chunks) {
-			memfree(chunks);
+		if (chunks.get()) {
+			memfree(chunks.get());
 			memfree(free_list_chunks);
-			memfree(validator_chunks);
+			memfree(validator_chunks.get());
+		}
+
+		for (void *table : retired_chunk_tables) {
+			memfree(table);
 		}
 	}
 };
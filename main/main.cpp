@@ -232,6 +232,7 @@ static int fixed_fps = -1;
 static MovieWriter *movie_writer = nullptr;
 static bool disable_vsync = false;
 static bool print_fps = false;
+static String worker_task_trace_file;
 #ifdef TOOLS_ENABLED
 static bool dump_gdextension_interface = false;
 static bool dump_extension_api = false;
@@ -597,6 +598,7 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--generate-spirv-debug-info", "Generate SPIR-V debug information. This allows source-level shader debugging with RenderDoc.\n");
 	print_help_option("--remote-debug <uri>", "Remote debug (<protocol>://<host/IP>[:<port>], e.g. tcp://127.0.0.1:6007).\n");
 	print_help_option("--single-threaded-scene", "Force scene tree to run in single-threaded mode. Sub-thread groups are disabled and run on the main thread.\n");
+	print_help_option("--trace-worker-tasks <path>", "Record when and on which worker thread each WorkerThreadPool task runs, and save the latest events to the given file in Chrome trace JSON format when the engine quits.\n");
 #if defined(DEBUG_ENABLED)
 	print_help_option("--debug-collisions", "Show collision shapes when running the scene.\n", CLI_OPTION_AVAILABILITY_TEMPLATE_DEBUG);
 	print_help_option("--debug-paths", "Show path lines when running the scene.\n", CLI_OPTION_AVAILABILITY_TEMPLATE_DEBUG);
@@ -1378,6 +1380,15 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			}
 		} else if (I->get() == "--single-threaded-scene") {
 			single_threaded_scene = true;
+		} else if (I->get() == "--trace-worker-tasks") {
+			if (I->next()) {
+				worker_task_trace_file = I->next()->get();
+				WorkerThreadPool::get_singleton()->set_tracing_enabled(true);
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing <path> argument for --trace-worker-tasks <path>.\n");
+				goto error;
+			}
 		} else if (I->get() == "--build-solutions") { // Build the scripting solution such C#
 
 			auto_build_solutions = true;
@@ -3933,6 +3944,7 @@ bool Main::iteration() {
 
 	const uint64_t ticks = OS::get_singleton()->get_ticks_usec();
 	Engine::get_singleton()->_frame_ticks = ticks;
+	WorkerThreadPool::get_singleton()->trace_frame();
 	main_timer_sync.set_cpu_ticks_usec(ticks);
 	main_timer_sync.set_fixed_fps(fixed_fps);
 
@@ -4299,6 +4311,10 @@ void Main::cleanup(bool p_force) {
 	message_queue->flush();
 	memdelete(message_queue);
 
+	if (!worker_task_trace_file.is_empty()) {
+		WorkerThreadPool::get_singleton()->save_trace(worker_task_trace_file);
+	}
+
 	unregister_core_driver_types();
 	unregister_core_extensions();
 	uninitialize_modules(MODULE_INITIALIZATION_LEVEL_CORE);
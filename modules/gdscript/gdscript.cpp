@@ -2272,6 +2272,15 @@ void GDScriptLanguage::profiling_start() {
 		elem = elem->next();
 	}
 
+#ifdef GDSCRIPT_PROFILE_OPCODE_PAIRS
+	if (opcode_pair_counts == nullptr) {
+		opcode_pair_counts = memnew_arr(SafeNumeric<uint64_t>, OPCODE_PAIR_STRIDE * OPCODE_PAIR_STRIDE);
+	}
+	for (int i = 0; i < OPCODE_PAIR_STRIDE * OPCODE_PAIR_STRIDE; i++) {
+		opcode_pair_counts[i].set(0);
+	}
+#endif
+
 	profiling = true;
 #endif
 }
@@ -2288,9 +2297,42 @@ void GDScriptLanguage::profiling_stop() {
 	MutexLock lock(mutex);
 
 	profiling = false;
+
+#ifdef GDSCRIPT_PROFILE_OPCODE_PAIRS
+	_print_opcode_pair_histogram();
+#endif
 #endif
 }
 
+#if defined(DEBUG_ENABLED) && defined(GDSCRIPT_PROFILE_OPCODE_PAIRS)
+void GDScriptLanguage::_print_opcode_pair_histogram() const {
+	struct OpcodePairCount {
+		uint64_t count = 0;
+		int pair = 0;
+
+		bool operator<(const OpcodePairCount &p_other) const {
+			return count > p_other.count; // Most frequent first.
+		}
+	};
+
+	LocalVector<OpcodePairCount> pairs;
+	for (int i = 0; i < OPCODE_PAIR_STRIDE * OPCODE_PAIR_STRIDE; i++) {
+		uint64_t count = opcode_pair_counts[i].get();
+		if (count > 0) {
+			pairs.push_back({ count, i });
+		}
+	}
+	pairs.sort();
+
+	print_line("GDScript opcode pairs (previous -> next: count):");
+	for (uint32_t i = 0; i < MIN(pairs.size(), 32u); i++) {
+		const GDScriptFunction::Opcode previous = GDScriptFunction::Opcode(pairs[i].pair / OPCODE_PAIR_STRIDE);
+		const GDScriptFunction::Opcode next = GDScriptFunction::Opcode(pairs[i].pair % OPCODE_PAIR_STRIDE);
+		print_line(vformat("  %s -> %s: %d", GDScriptFunction::get_opcode_name(previous), GDScriptFunction::get_opcode_name(next), pairs[i].count));
+	}
+}
+#endif
+
 int GDScriptLanguage::profiling_get_accumulated_data(ProfilingInfo *p_info_arr, int p_info_max) {
 	int current = 0;
 #ifdef DEBUG_ENABLED
@@ -2841,6 +2883,11 @@ GDScriptLanguage::GDScriptLanguage() {
 }
 
 GDScriptLanguage::~GDScriptLanguage() {
+#if defined(DEBUG_ENABLED) && defined(GDSCRIPT_PROFILE_OPCODE_PAIRS)
+	if (opcode_pair_counts != nullptr) {
+		memdelete_arr(opcode_pair_counts);
+	}
+#endif
 	singleton = nullptr;
 }
 
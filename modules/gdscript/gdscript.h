@@ -461,6 +461,12 @@ class GDScriptLanguage : public ScriptLanguage {
 	SelfList<GDScriptFunction>::List function_list;
 	bool profiling;
 	bool profile_native_calls;
+#if defined(DEBUG_ENABLED) && defined(GDSCRIPT_PROFILE_OPCODE_PAIRS)
+	static constexpr int OPCODE_PAIR_STRIDE = GDScriptFunction::OPCODE_END + 1;
+	// Execution counts of consecutive opcodes, indexed by `previous * OPCODE_PAIR_STRIDE + next`.
+	SafeNumeric<uint64_t> *opcode_pair_counts = nullptr;
+	void _print_opcode_pair_histogram() const;
+#endif
 	uint64_t script_frame_time;
 
 	HashMap<String, ObjectID> orphan_subclasses;
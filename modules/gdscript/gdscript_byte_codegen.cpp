@@ -584,6 +584,109 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 	}
 }
 
+GDScriptFunction::Opcode GDScriptByteCodeGenerator::get_specialized_operator_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type) const {
+	if (p_left_type == Variant::INT && p_right_type == Variant::INT) {
+		switch (p_operator) {
+			case Variant::OP_ADD:
+				return GDScriptFunction::OPCODE_OPERATOR_ADD_INT;
+			case Variant::OP_SUBTRACT:
+				return GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_INT;
+			case Variant::OP_MULTIPLY:
+				return GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_INT;
+			case Variant::OP_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_EQUAL_INT;
+			case Variant::OP_NOT_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_NOT_EQUAL_INT;
+			case Variant::OP_LESS:
+				return GDScriptFunction::OPCODE_OPERATOR_LESS_INT;
+			case Variant::OP_LESS_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_LESS_EQUAL_INT;
+			case Variant::OP_GREATER:
+				return GDScriptFunction::OPCODE_OPERATOR_GREATER_INT;
+			case Variant::OP_GREATER_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_GREATER_EQUAL_INT;
+			default:
+				break;
+		}
+	} else if (p_left_type == Variant::FLOAT && p_right_type == Variant::FLOAT) {
+		switch (p_operator) {
+			case Variant::OP_ADD:
+				return GDScriptFunction::OPCODE_OPERATOR_ADD_FLOAT;
+			case Variant::OP_SUBTRACT:
+				return GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_FLOAT;
+			case Variant::OP_MULTIPLY:
+				return GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_FLOAT;
+			case Variant::OP_DIVIDE:
+				return GDScriptFunction::OPCODE_OPERATOR_DIVIDE_FLOAT;
+			case Variant::OP_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_EQUAL_FLOAT;
+			case Variant::OP_NOT_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_NOT_EQUAL_FLOAT;
+			case Variant::OP_LESS:
+				return GDScriptFunction::OPCODE_OPERATOR_LESS_FLOAT;
+			case Variant::OP_LESS_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_LESS_EQUAL_FLOAT;
+			case Variant::OP_GREATER:
+				return GDScriptFunction::OPCODE_OPERATOR_GREATER_FLOAT;
+			case Variant::OP_GREATER_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_GREATER_EQUAL_FLOAT;
+			default:
+				break;
+		}
+	}
+	return GDScriptFunction::OPCODE_END; // No specialized opcode.
+}
+
+GDScriptFunction::Opcode GDScriptByteCodeGenerator::get_fused_jump_if_not_opcode(GDScriptFunction::Opcode p_compare_opcode) const {
+	switch (p_compare_opcode) {
+		case GDScriptFunction::OPCODE_OPERATOR_EQUAL_INT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_EQUAL_INT;
+		case GDScriptFunction::OPCODE_OPERATOR_NOT_EQUAL_INT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_NOT_EQUAL_INT;
+		case GDScriptFunction::OPCODE_OPERATOR_LESS_INT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_LESS_INT;
+		case GDScriptFunction::OPCODE_OPERATOR_LESS_EQUAL_INT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_LESS_EQUAL_INT;
+		case GDScriptFunction::OPCODE_OPERATOR_GREATER_INT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_GREATER_INT;
+		case GDScriptFunction::OPCODE_OPERATOR_GREATER_EQUAL_INT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_GREATER_EQUAL_INT;
+		case GDScriptFunction::OPCODE_OPERATOR_EQUAL_FLOAT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_EQUAL_FLOAT;
+		case GDScriptFunction::OPCODE_OPERATOR_NOT_EQUAL_FLOAT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_NOT_EQUAL_FLOAT;
+		case GDScriptFunction::OPCODE_OPERATOR_LESS_FLOAT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_LESS_FLOAT;
+		case GDScriptFunction::OPCODE_OPERATOR_LESS_EQUAL_FLOAT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_LESS_EQUAL_FLOAT;
+		case GDScriptFunction::OPCODE_OPERATOR_GREATER_FLOAT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_GREATER_FLOAT;
+		case GDScriptFunction::OPCODE_OPERATOR_GREATER_EQUAL_FLOAT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_GREATER_EQUAL_FLOAT;
+		default:
+			return GDScriptFunction::OPCODE_END; // Not a fusable comparison.
+	}
+}
+
+bool GDScriptByteCodeGenerator::fuse_compare_jump_if_not(const Address &p_condition) {
+	// Only when the condition is the temporary the comparison just wrote to, since it won't be written anymore.
+	if (p_condition.mode != Address::TEMPORARY || last_compare_pos < 0 || last_compare_pos + 4 != opcodes.size()) {
+		return false;
+	}
+
+	Vector<int> &indices = temporaries.write[p_condition.address].bytecode_indices;
+	if (indices.is_empty() || indices[indices.size() - 1] != last_compare_pos + 3) {
+		return false;
+	}
+
+	// Reuse the comparison operands, the jump destination takes the place of the result address.
+	indices.remove_at(indices.size() - 1);
+	opcodes.write[last_compare_pos] = get_fused_jump_if_not_opcode(GDScriptFunction::Opcode(opcodes[last_compare_pos]));
+	opcodes.resize(last_compare_pos + 3);
+	last_compare_pos = -1;
+	return true;
+}
+
 void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
 	// Avoid validated evaluator for modulo and division when operands are int, since there's no check for division by zero.
 	if (HAS_BUILTIN_TYPE(p_left_operand) && HAS_BUILTIN_TYPE(p_right_operand) && ((p_operator != Variant::OP_DIVIDE && p_operator != Variant::OP_MODULE) || p_left_operand.type.builtin_type != Variant::INT || p_right_operand.type.builtin_type != Variant::INT)) {
@@ -595,6 +698,20 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 			}
 		}
 
+		// Common int and float operations have their own opcodes.
+		GDScriptFunction::Opcode specialized_opcode = get_specialized_operator_opcode(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+		if (specialized_opcode != GDScriptFunction::OPCODE_END) {
+			int pos = opcodes.size();
+			append_opcode(specialized_opcode);
+			append(p_left_operand);
+			append(p_right_operand);
+			append(p_target);
+			if (get_fused_jump_if_not_opcode(specialized_opcode) != GDScriptFunction::OPCODE_END) {
+				last_compare_pos = pos;
+			}
+			return;
+		}
+
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
@@ -1442,8 +1559,10 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (!fuse_compare_jump_if_not(p_condition)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1649,12 +1768,15 @@ void GDScriptByteCodeGenerator::write_endfor() {
 void GDScriptByteCodeGenerator::start_while_condition() {
 	current_breaks_to_patch.push_back(List<int>());
 	continue_addrs.push_back(opcodes.size());
+	last_compare_pos = -1; // Loop start is a jump target.
 }
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (!fuse_compare_jump_if_not(p_condition)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
@@ -148,6 +148,9 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	List<int> while_jmp_addrs;
 	List<int> continue_addrs;
 
+	// Position of a specialized comparison emitted last, so a following conditional jump can be fused with it.
+	int last_compare_pos = -1;
+
 	// Used to patch jumps with `and` and `or` operators with short-circuit.
 	List<int> logic_op_jump_pos1;
 	List<int> logic_op_jump_pos2;
@@ -350,6 +353,8 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	}
 
 	CallTarget get_call_target(const Address &p_target, Variant::Type p_type = Variant::NIL);
+	GDScriptFunction::Opcode get_specialized_operator_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type) const;
+	GDScriptFunction::Opcode get_fused_jump_if_not_opcode(GDScriptFunction::Opcode p_compare_opcode) const;
 
 	int address_of(const Address &p_address) {
 		switch (p_address.mode) {
@@ -449,8 +454,11 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
+		last_compare_pos = -1; // Code may now jump between the comparison and what follows.
 	}
 
+	bool fuse_compare_jump_if_not(const Address &p_condition);
+
 public:
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
@@ -81,6 +81,9 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 					source_hash = source.hash();
 					result = get_parser()->parse(source, path, false);
 				}
+				if (result == OK) {
+					GDScriptCache::prefetch_dependencies(path, parser);
+				}
 			} break;
 			case PARSED: {
 				status = INHERITANCE_SOLVED;
@@ -158,6 +161,11 @@ void GDScriptCache::move_script(const String &p_from, const String &p_to) {
 	}
 	singleton->parser_map.erase(p_from);
 
+	if (singleton->prefetched_parsers.has(p_from) && !p_from.is_empty()) {
+		singleton->prefetched_parsers[p_to] = singleton->prefetched_parsers[p_from];
+	}
+	singleton->prefetched_parsers.erase(p_from);
+
 	if (singleton->shallow_gdscript_cache.has(p_from) && !p_from.is_empty()) {
 		singleton->shallow_gdscript_cache[p_to] = singleton->shallow_gdscript_cache[p_from];
 	}
@@ -185,6 +193,7 @@ void GDScriptCache::remove_script(const String &p_path) {
 		// Clearing it can trigger a reference to itself to go out of scope, destructing it before clear finishes.
 		Ref<GDScriptParserRef> parser_ref = singleton->parser_map[p_path];
 		singleton->parser_map.erase(p_path);
+		singleton->prefetched_parsers.erase(p_path);
 		parser_ref->clear();
 	}
 
@@ -205,6 +214,8 @@ Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptP
 			r_error = ERR_INVALID_DATA;
 			return ref;
 		}
+		// From here on the caller keeps a prefetched parser alive.
+		singleton->prefetched_parsers.erase(p_path);
 	} else {
 		String remapped_path = ResourceLoader::path_remap(p_path);
 		if (!FileAccess::exists(remapped_path)) {
@@ -229,6 +240,178 @@ void GDScriptCache::remove_parser(const String &p_path) {
 	MutexLock lock(singleton->mutex);
 	// Can't clear the parser because some other parser might be currently using it in the chain of calls.
 	singleton->parser_map.erase(p_path);
+	singleton->prefetched_parsers.erase(p_path);
+}
+
+static void _collect_class_dependency_paths(const GDScriptParser::ClassNode *p_class, const String &p_base_dir, HashSet<String> &r_paths) {
+	if (!p_class->extends_path.is_empty()) {
+		String path = p_class->extends_path;
+		if (path.is_relative_path()) {
+			path = p_base_dir.path_join(path);
+		}
+		r_paths.insert(path.simplify_path());
+	} else if (!p_class->extends.is_empty() && ScriptServer::is_global_class(p_class->extends[0]->name)) {
+		r_paths.insert(ScriptServer::get_global_class_path(p_class->extends[0]->name));
+	}
+
+	for (const GDScriptParser::ClassNode::Member &member : p_class->members) {
+		if (member.type == GDScriptParser::ClassNode::Member::CLASS) {
+			_collect_class_dependency_paths(member.m_class, p_base_dir, r_paths);
+		}
+	}
+}
+
+// Only what is known right after parsing: literal super class paths, global
+// super classes and literal preloads. The analyzer still finds the rest.
+static void _collect_dependency_paths(const String &p_path, const GDScriptParser *p_parser, HashSet<String> &r_paths) {
+	const GDScriptParser::ClassNode *tree = p_parser->get_tree();
+	if (tree == nullptr) {
+		return;
+	}
+	const String base_dir = p_path.get_base_dir();
+	HashSet<String> paths;
+	_collect_class_dependency_paths(tree, base_dir, paths);
+	for (const String &preload_path : p_parser->get_preload_paths()) {
+		String path = preload_path;
+		if (path.is_relative_path()) {
+			path = base_dir.path_join(path);
+		}
+		paths.insert(path.simplify_path());
+	}
+
+	const String extension = GDScriptLanguage::get_singleton()->get_extension();
+	for (const String &path : paths) {
+		if (path != p_path && path.get_extension().to_lower() == extension) {
+			r_paths.insert(path);
+		}
+	}
+}
+
+void GDScriptCache::_prefetch_parse_batch(PrefetchBatch *p_batch) {
+	const uint32_t task_count = p_batch->tasks.size();
+	while (true) {
+		uint32_t index = p_batch->next_task.postincrement();
+		if (index >= task_count) {
+			return;
+		}
+
+		// Same as the first step of `GDScriptParserRef::raise_status()`, without touching the cache.
+		PrefetchTask &task = p_batch->tasks[index];
+		task.parser = memnew(GDScriptParser);
+		if (task.remapped_path.get_extension().to_lower() == "gdc") {
+			Vector<uint8_t> tokens = get_binary_tokens(task.remapped_path);
+			task.source_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
+			task.result = task.parser->parse_binary(tokens, task.path);
+		} else {
+			String source = get_source_code(task.remapped_path);
+			task.source_hash = source.hash();
+			task.result = task.parser->parse(source, task.path, false);
+		}
+
+		if (p_batch->finished_tasks.increment() == task_count) {
+			p_batch->done.post();
+		}
+	}
+}
+
+void GDScriptCache::_prefetch_parse_group_task(void *p_batch, uint32_t p_index) {
+	_prefetch_parse_batch((PrefetchBatch *)p_batch);
+}
+
+void GDScriptCache::_free_prefetch_batches(bool p_wait) {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	for (uint32_t i = 0; i < singleton->prefetch_batches.size();) {
+		PrefetchBatch *batch = singleton->prefetch_batches[i];
+		if (!p_wait && !pool->is_group_task_completed(batch->group_id)) {
+			i++;
+			continue;
+		}
+		pool->wait_for_group_task_completion(batch->group_id);
+		memdelete(batch);
+		singleton->prefetch_batches.remove_at_unordered(i);
+	}
+}
+
+void GDScriptCache::prefetch_dependencies(const String &p_path, const GDScriptParser *p_parser) {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (singleton == nullptr || pool == nullptr || pool->get_thread_count() == 0) {
+		return;
+	}
+
+	MutexLock lock(singleton->mutex);
+
+	// Only while a full script loads: its analysis asks for the prefetched parsers, and the outermost `get_full_script()` drops the rest.
+	// Parses from anywhere else, e.g. the editor or a plain `reload()`, are never analyzed further and would keep their leftovers alive.
+	if (singleton->cleared || singleton->full_script_depth == 0) {
+		return;
+	}
+
+	_free_prefetch_batches(false);
+
+	// Lazily built and shared by all parsers, so build it before workers can race on it.
+	GDScriptParser::get_builtin_type(StringName());
+
+	HashSet<String> paths;
+	_collect_dependency_paths(p_path, p_parser, paths);
+
+	// One dependency level per batch, so the scripts found by a batch are scheduled only after it's parsed.
+	while (!paths.is_empty()) {
+		PrefetchBatch *batch = memnew(PrefetchBatch);
+		for (const String &path : paths) {
+			// Fully loaded scripts are not analyzed again, so their parsers would never be asked for.
+			if (singleton->parser_map.has(path) || singleton->full_gdscript_cache.has(path)) {
+				continue;
+			}
+			String remapped_path = ResourceLoader::path_remap(path);
+			if (!FileAccess::exists(remapped_path)) {
+				continue;
+			}
+			PrefetchTask task;
+			task.path = path;
+			task.remapped_path = remapped_path;
+			batch->tasks.push_back(task);
+		}
+		paths.clear();
+
+		if (batch->tasks.is_empty()) {
+			memdelete(batch);
+			break;
+		}
+
+		// The calling thread takes part, so workers only help when there is more than one script.
+		int worker_count = MIN((int)batch->tasks.size() - 1, pool->get_thread_count());
+		if (worker_count > 0) {
+			batch->group_id = pool->add_native_group_task(&GDScriptCache::_prefetch_parse_group_task, batch, worker_count, worker_count, true, String("GDScriptCachePrefetch"));
+		}
+		_prefetch_parse_batch(batch);
+		// Whatever is left is being parsed right now. Workers that haven't started yet find nothing to do,
+		// so never wait for the group itself here: those workers might be blocked on this mutex.
+		batch->done.wait();
+
+		for (PrefetchTask &task : batch->tasks) {
+			Ref<GDScriptParserRef> ref;
+			ref.instantiate();
+			ref->path = task.path;
+			ref->parser = task.parser;
+			ref->status = GDScriptParserRef::PARSED;
+			ref->result = task.result;
+			ref->source_hash = task.source_hash;
+			task.parser = nullptr;
+
+			singleton->parser_map[task.path] = ref.ptr();
+			singleton->prefetched_parsers[task.path] = ref;
+
+			if (ref->result == OK) {
+				_collect_dependency_paths(task.path, ref->parser, paths);
+			}
+		}
+
+		if (worker_count > 0) {
+			singleton->prefetch_batches.push_back(batch);
+		} else {
+			memdelete(batch);
+		}
+	}
 }
 
 String GDScriptCache::get_source_code(const String &p_path) {
@@ -304,8 +487,19 @@ Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_e
 	return script;
 }
 
+GDScriptCache::FullScriptScope::FullScriptScope() {
+	singleton->full_script_depth++;
+}
+
+GDScriptCache::FullScriptScope::~FullScriptScope() {
+	if (--singleton->full_script_depth == 0) {
+		singleton->prefetched_parsers.clear();
+	}
+}
+
 Ref<GDScript> GDScriptCache::get_full_script(const String &p_path, Error &r_error, const String &p_owner, bool p_update_from_disk) {
 	MutexLock lock(singleton->mutex);
+	FullScriptScope scope;
 
 	if (!p_owner.is_empty()) {
 		singleton->dependencies[p_owner].insert(p_path);
@@ -423,6 +617,7 @@ void GDScriptCache::clear() {
 	}
 
 	singleton->parser_map.clear();
+	singleton->prefetched_parsers.clear();
 
 	for (Ref<GDScriptParserRef> &E : parser_map_refs) {
 		if (E.is_valid()) {
@@ -443,5 +638,6 @@ GDScriptCache::~GDScriptCache() {
 	if (!cleared) {
 		clear();
 	}
+	_free_prefetch_batches(true);
 	singleton = nullptr;
 }
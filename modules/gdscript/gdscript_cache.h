@@ -34,9 +34,13 @@
 #include "gdscript.h"
 
 #include "core/object/ref_counted.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
+#include "core/os/semaphore.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 
 class GDScriptAnalyzer;
 class GDScriptParser;
@@ -94,6 +98,43 @@ class GDScriptCache {
 
 	Mutex mutex;
 
+	// Dependencies are parsed ahead of the analyzer on the WorkerThreadPool.
+	// Workers claim scripts from a shared batch and never touch the cache, so
+	// the thread that holds the mutex can finish unclaimed work by itself and
+	// only waits for parses that are already running.
+	struct PrefetchTask {
+		String path;
+		String remapped_path;
+		GDScriptParser *parser = nullptr;
+		Error result = OK;
+		uint32_t source_hash = 0;
+	};
+
+	struct PrefetchBatch {
+		LocalVector<PrefetchTask> tasks;
+		SafeNumeric<uint32_t> next_task;
+		SafeNumeric<uint32_t> finished_tasks;
+		Semaphore done;
+		WorkerThreadPool::GroupID group_id = -1;
+	};
+
+	// Parsed dependencies nobody asked for yet. `parser_map` doesn't own its
+	// entries, so these are kept alive until the first `get_parser()` call.
+	HashMap<String, Ref<GDScriptParserRef>> prefetched_parsers;
+	// Batches whose worker group may still be starting; freed once it's done.
+	LocalVector<PrefetchBatch *> prefetch_batches;
+	// Nesting of `get_full_script()`. Dependencies are only prefetched inside it, and leftovers are dropped when the outermost one returns, so they can't go stale.
+	int full_script_depth = 0;
+
+	struct FullScriptScope {
+		FullScriptScope();
+		~FullScriptScope();
+	};
+
+	static void _prefetch_parse_batch(PrefetchBatch *p_batch);
+	static void _prefetch_parse_group_task(void *p_batch, uint32_t p_index);
+	static void _free_prefetch_batches(bool p_wait);
+
 public:
 	static void move_script(const String &p_from, const String &p_to);
 	static void remove_script(const String &p_path);
@@ -108,6 +149,7 @@ public:
 	static Error finish_compiling(const String &p_owner);
 	static void add_static_script(Ref<GDScript> p_script);
 	static void remove_static_script(const String &p_fqcn);
+	static void prefetch_dependencies(const String &p_path, const GDScriptParser *p_parser);
 
 	static void clear();
 
@@ -141,6 +141,39 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+
+#define DISASSEMBLE_OPERATOR_SPECIALIZED(m_name, m_operator) \
+	case OPCODE_OPERATOR_##m_name: {                       \
+		text += "operator (";                               \
+		text += #m_name;                                    \
+		text += ") ";                                       \
+		text += DADDR(3);                                   \
+		text += " = ";                                      \
+		text += DADDR(1);                                   \
+		text += " " #m_operator " ";                        \
+		text += DADDR(2);                                   \
+		incr += 4;                                          \
+	} break
+
+			DISASSEMBLE_OPERATOR_SPECIALIZED(ADD_INT, +);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(SUBTRACT_INT, -);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(MULTIPLY_INT, *);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(EQUAL_INT, ==);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(NOT_EQUAL_INT, !=);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(LESS_INT, <);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(LESS_EQUAL_INT, <=);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(GREATER_INT, >);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(GREATER_EQUAL_INT, >=);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(ADD_FLOAT, +);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(SUBTRACT_FLOAT, -);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(MULTIPLY_FLOAT, *);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(DIVIDE_FLOAT, /);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(EQUAL_FLOAT, ==);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(NOT_EQUAL_FLOAT, !=);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(LESS_FLOAT, <);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(LESS_EQUAL_FLOAT, <=);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(GREATER_FLOAT, >);
+			DISASSEMBLE_OPERATOR_SPECIALIZED(GREATER_EQUAL_FLOAT, >=);
 			case OPCODE_TYPE_TEST_BUILTIN: {
 				text += "type test ";
 				text += DADDR(1);
@@ -945,6 +978,32 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr = 3;
 			} break;
+
+#define DISASSEMBLE_JUMP_IF_NOT_COMPARE(m_name, m_operator) \
+	case OPCODE_JUMP_IF_NOT_##m_name: {                    \
+		text += "jump-if-not (";                            \
+		text += #m_name;                                    \
+		text += ") ";                                       \
+		text += DADDR(1);                                   \
+		text += " " #m_operator " ";                        \
+		text += DADDR(2);                                   \
+		text += " to ";                                     \
+		text += itos(_code_ptr[ip + 3]);                    \
+		incr += 4;                                          \
+	} break
+
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(EQUAL_INT, ==);
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(NOT_EQUAL_INT, !=);
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(LESS_INT, <);
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(LESS_EQUAL_INT, <=);
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(GREATER_INT, >);
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(GREATER_EQUAL_INT, >=);
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(EQUAL_FLOAT, ==);
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(NOT_EQUAL_FLOAT, !=);
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(LESS_FLOAT, <);
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(LESS_EQUAL_FLOAT, <=);
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(GREATER_FLOAT, >);
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(GREATER_EQUAL_FLOAT, >=);
 			case OPCODE_JUMP_TO_DEF_ARGUMENT: {
 				text += "jump-to-default-argument ";
 
@@ -1181,4 +1240,198 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 	}
 }
 
+#ifdef GDSCRIPT_PROFILE_OPCODE_PAIRS
+const char *GDScriptFunction::get_opcode_name(Opcode p_opcode) {
+	static const char *opcode_names[] = {
+		"OPERATOR",
+		"OPERATOR_VALIDATED",
+		"OPERATOR_ADD_INT",
+		"OPERATOR_SUBTRACT_INT",
+		"OPERATOR_MULTIPLY_INT",
+		"OPERATOR_EQUAL_INT",
+		"OPERATOR_NOT_EQUAL_INT",
+		"OPERATOR_LESS_INT",
+		"OPERATOR_LESS_EQUAL_INT",
+		"OPERATOR_GREATER_INT",
+		"OPERATOR_GREATER_EQUAL_INT",
+		"OPERATOR_ADD_FLOAT",
+		"OPERATOR_SUBTRACT_FLOAT",
+		"OPERATOR_MULTIPLY_FLOAT",
+		"OPERATOR_DIVIDE_FLOAT",
+		"OPERATOR_EQUAL_FLOAT",
+		"OPERATOR_NOT_EQUAL_FLOAT",
+		"OPERATOR_LESS_FLOAT",
+		"OPERATOR_LESS_EQUAL_FLOAT",
+		"OPERATOR_GREATER_FLOAT",
+		"OPERATOR_GREATER_EQUAL_FLOAT",
+		"TYPE_TEST_BUILTIN",
+		"TYPE_TEST_ARRAY",
+		"TYPE_TEST_NATIVE",
+		"TYPE_TEST_SCRIPT",
+		"SET_KEYED",
+		"SET_KEYED_VALIDATED",
+		"SET_INDEXED_VALIDATED",
+		"GET_KEYED",
+		"GET_KEYED_VALIDATED",
+		"GET_INDEXED_VALIDATED",
+		"SET_NAMED",
+		"SET_NAMED_VALIDATED",
+		"GET_NAMED",
+		"GET_NAMED_VALIDATED",
+		"SET_MEMBER",
+		"GET_MEMBER",
+		"SET_STATIC_VARIABLE",
+		"GET_STATIC_VARIABLE",
+		"ASSIGN",
+		"ASSIGN_NULL",
+		"ASSIGN_TRUE",
+		"ASSIGN_FALSE",
+		"ASSIGN_TYPED_BUILTIN",
+		"ASSIGN_TYPED_ARRAY",
+		"ASSIGN_TYPED_NATIVE",
+		"ASSIGN_TYPED_SCRIPT",
+		"CAST_TO_BUILTIN",
+		"CAST_TO_NATIVE",
+		"CAST_TO_SCRIPT",
+		"CONSTRUCT",
+		"CONSTRUCT_VALIDATED",
+		"CONSTRUCT_ARRAY",
+		"CONSTRUCT_TYPED_ARRAY",
+		"CONSTRUCT_DICTIONARY",
+		"CALL",
+		"CALL_RETURN",
+		"CALL_ASYNC",
+		"CALL_UTILITY",
+		"CALL_UTILITY_VALIDATED",
+		"CALL_GDSCRIPT_UTILITY",
+		"CALL_BUILTIN_TYPE_VALIDATED",
+		"CALL_SELF_BASE",
+		"CALL_METHOD_BIND",
+		"CALL_METHOD_BIND_RET",
+		"CALL_BUILTIN_STATIC",
+		"CALL_NATIVE_STATIC",
+		"CALL_NATIVE_STATIC_VALIDATED_RETURN",
+		"CALL_NATIVE_STATIC_VALIDATED_NO_RETURN",
+		"CALL_METHOD_BIND_VALIDATED_RETURN",
+		"CALL_METHOD_BIND_VALIDATED_NO_RETURN",
+		"AWAIT",
+		"AWAIT_RESUME",
+		"CREATE_LAMBDA",
+		"CREATE_SELF_LAMBDA",
+		"JUMP",
+		"JUMP_IF",
+		"JUMP_IF_NOT",
+		"JUMP_IF_NOT_EQUAL_INT",
+		"JUMP_IF_NOT_NOT_EQUAL_INT",
+		"JUMP_IF_NOT_LESS_INT",
+		"JUMP_IF_NOT_LESS_EQUAL_INT",
+		"JUMP_IF_NOT_GREATER_INT",
+		"JUMP_IF_NOT_GREATER_EQUAL_INT",
+		"JUMP_IF_NOT_EQUAL_FLOAT",
+		"JUMP_IF_NOT_NOT_EQUAL_FLOAT",
+		"JUMP_IF_NOT_LESS_FLOAT",
+		"JUMP_IF_NOT_LESS_EQUAL_FLOAT",
+		"JUMP_IF_NOT_GREATER_FLOAT",
+		"JUMP_IF_NOT_GREATER_EQUAL_FLOAT",
+		"JUMP_TO_DEF_ARGUMENT",
+		"JUMP_IF_SHARED",
+		"RETURN",
+		"RETURN_TYPED_BUILTIN",
+		"RETURN_TYPED_ARRAY",
+		"RETURN_TYPED_NATIVE",
+		"RETURN_TYPED_SCRIPT",
+		"ITERATE_BEGIN",
+		"ITERATE_BEGIN_INT",
+		"ITERATE_BEGIN_FLOAT",
+		"ITERATE_BEGIN_VECTOR2",
+		"ITERATE_BEGIN_VECTOR2I",
+		"ITERATE_BEGIN_VECTOR3",
+		"ITERATE_BEGIN_VECTOR3I",
+		"ITERATE_BEGIN_STRING",
+		"ITERATE_BEGIN_DICTIONARY",
+		"ITERATE_BEGIN_ARRAY",
+		"ITERATE_BEGIN_PACKED_BYTE_ARRAY",
+		"ITERATE_BEGIN_PACKED_INT32_ARRAY",
+		"ITERATE_BEGIN_PACKED_INT64_ARRAY",
+		"ITERATE_BEGIN_PACKED_FLOAT32_ARRAY",
+		"ITERATE_BEGIN_PACKED_FLOAT64_ARRAY",
+		"ITERATE_BEGIN_PACKED_STRING_ARRAY",
+		"ITERATE_BEGIN_PACKED_VECTOR2_ARRAY",
+		"ITERATE_BEGIN_PACKED_VECTOR3_ARRAY",
+		"ITERATE_BEGIN_PACKED_COLOR_ARRAY",
+		"ITERATE_BEGIN_PACKED_VECTOR4_ARRAY",
+		"ITERATE_BEGIN_OBJECT",
+		"ITERATE",
+		"ITERATE_INT",
+		"ITERATE_FLOAT",
+		"ITERATE_VECTOR2",
+		"ITERATE_VECTOR2I",
+		"ITERATE_VECTOR3",
+		"ITERATE_VECTOR3I",
+		"ITERATE_STRING",
+		"ITERATE_DICTIONARY",
+		"ITERATE_ARRAY",
+		"ITERATE_PACKED_BYTE_ARRAY",
+		"ITERATE_PACKED_INT32_ARRAY",
+		"ITERATE_PACKED_INT64_ARRAY",
+		"ITERATE_PACKED_FLOAT32_ARRAY",
+		"ITERATE_PACKED_FLOAT64_ARRAY",
+		"ITERATE_PACKED_STRING_ARRAY",
+		"ITERATE_PACKED_VECTOR2_ARRAY",
+		"ITERATE_PACKED_VECTOR3_ARRAY",
+		"ITERATE_PACKED_COLOR_ARRAY",
+		"ITERATE_PACKED_VECTOR4_ARRAY",
+		"ITERATE_OBJECT",
+		"STORE_GLOBAL",
+		"STORE_NAMED_GLOBAL",
+		"TYPE_ADJUST_BOOL",
+		"TYPE_ADJUST_INT",
+		"TYPE_ADJUST_FLOAT",
+		"TYPE_ADJUST_STRING",
+		"TYPE_ADJUST_VECTOR2",
+		"TYPE_ADJUST_VECTOR2I",
+		"TYPE_ADJUST_RECT2",
+		"TYPE_ADJUST_RECT2I",
+		"TYPE_ADJUST_VECTOR3",
+		"TYPE_ADJUST_VECTOR3I",
+		"TYPE_ADJUST_TRANSFORM2D",
+		"TYPE_ADJUST_VECTOR4",
+		"TYPE_ADJUST_VECTOR4I",
+		"TYPE_ADJUST_PLANE",
+		"TYPE_ADJUST_QUATERNION",
+		"TYPE_ADJUST_AABB",
+		"TYPE_ADJUST_BASIS",
+		"TYPE_ADJUST_TRANSFORM3D",
+		"TYPE_ADJUST_PROJECTION",
+		"TYPE_ADJUST_COLOR",
+		"TYPE_ADJUST_STRING_NAME",
+		"TYPE_ADJUST_NODE_PATH",
+		"TYPE_ADJUST_RID",
+		"TYPE_ADJUST_OBJECT",
+		"TYPE_ADJUST_CALLABLE",
+		"TYPE_ADJUST_SIGNAL",
+		"TYPE_ADJUST_DICTIONARY",
+		"TYPE_ADJUST_ARRAY",
+		"TYPE_ADJUST_PACKED_BYTE_ARRAY",
+		"TYPE_ADJUST_PACKED_INT32_ARRAY",
+		"TYPE_ADJUST_PACKED_INT64_ARRAY",
+		"TYPE_ADJUST_PACKED_FLOAT32_ARRAY",
+		"TYPE_ADJUST_PACKED_FLOAT64_ARRAY",
+		"TYPE_ADJUST_PACKED_STRING_ARRAY",
+		"TYPE_ADJUST_PACKED_VECTOR2_ARRAY",
+		"TYPE_ADJUST_PACKED_VECTOR3_ARRAY",
+		"TYPE_ADJUST_PACKED_COLOR_ARRAY",
+		"TYPE_ADJUST_PACKED_VECTOR4_ARRAY",
+		"ASSERT",
+		"BREAKPOINT",
+		"LINE",
+		"END",
+	};
+	static_assert((sizeof(opcode_names) / sizeof(opcode_names[0]) == (OPCODE_END + 1)), "Opcode names aren't the same as opcodes in enum.");
+
+	ERR_FAIL_INDEX_V(p_opcode, OPCODE_END + 1, "");
+	return opcode_names[p_opcode];
+}
+#endif
+
 #endif // DEBUG_ENABLED
@@ -3318,6 +3318,12 @@ GDScriptParser::ExpressionNode *GDScriptParser::parse_preload(ExpressionNode *p_
 
 	if (preload->path == nullptr) {
 		push_error(R"(Expected resource path after "(".)");
+	} else if (preload->path->type == Node::LITERAL) {
+		// Recorded so the cache can fetch the dependency before the analyzer reduces the path.
+		const Variant &path = static_cast<LiteralNode *>(preload->path)->value;
+		if (path.get_type() == Variant::STRING) {
+			preload_paths.push_back(path);
+		}
 	}
 
 	pop_completion_call();
@@ -1433,6 +1433,7 @@ private:
 	void reset_extents(Node *p_node, Node *p_from);
 
 	HashSet<String> dependencies;
+	Vector<String> preload_paths; // Literal `preload()` arguments, unresolved.
 
 	template <typename T>
 	T *alloc_node() {
@@ -1583,6 +1584,7 @@ public:
 	void add_dependency(const String &p_dependency) {
 		dependencies.insert(p_dependency);
 	}
+	const Vector<String> &get_preload_paths() const { return preload_paths; }
 #ifdef DEBUG_ENABLED
 	const List<GDScriptWarning> &get_warnings() const { return warnings; }
 	const HashSet<int> &get_unsafe_lines() const { return unsafe_lines; }
@@ -216,6 +216,25 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = {            \
 		&&OPCODE_OPERATOR,                               \
 		&&OPCODE_OPERATOR_VALIDATED,                     \
+		&&OPCODE_OPERATOR_ADD_INT,                       \
+		&&OPCODE_OPERATOR_SUBTRACT_INT,                  \
+		&&OPCODE_OPERATOR_MULTIPLY_INT,                  \
+		&&OPCODE_OPERATOR_EQUAL_INT,                     \
+		&&OPCODE_OPERATOR_NOT_EQUAL_INT,                 \
+		&&OPCODE_OPERATOR_LESS_INT,                      \
+		&&OPCODE_OPERATOR_LESS_EQUAL_INT,                \
+		&&OPCODE_OPERATOR_GREATER_INT,                   \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_INT,             \
+		&&OPCODE_OPERATOR_ADD_FLOAT,                     \
+		&&OPCODE_OPERATOR_SUBTRACT_FLOAT,                \
+		&&OPCODE_OPERATOR_MULTIPLY_FLOAT,                \
+		&&OPCODE_OPERATOR_DIVIDE_FLOAT,                  \
+		&&OPCODE_OPERATOR_EQUAL_FLOAT,                   \
+		&&OPCODE_OPERATOR_NOT_EQUAL_FLOAT,               \
+		&&OPCODE_OPERATOR_LESS_FLOAT,                    \
+		&&OPCODE_OPERATOR_LESS_EQUAL_FLOAT,              \
+		&&OPCODE_OPERATOR_GREATER_FLOAT,                 \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_FLOAT,           \
 		&&OPCODE_TYPE_TEST_BUILTIN,                      \
 		&&OPCODE_TYPE_TEST_ARRAY,                        \
 		&&OPCODE_TYPE_TEST_NATIVE,                       \
@@ -273,6 +292,18 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_JUMP,                                   \
 		&&OPCODE_JUMP_IF,                                \
 		&&OPCODE_JUMP_IF_NOT,                            \
+		&&OPCODE_JUMP_IF_NOT_EQUAL_INT,                  \
+		&&OPCODE_JUMP_IF_NOT_NOT_EQUAL_INT,              \
+		&&OPCODE_JUMP_IF_NOT_LESS_INT,                   \
+		&&OPCODE_JUMP_IF_NOT_LESS_EQUAL_INT,             \
+		&&OPCODE_JUMP_IF_NOT_GREATER_INT,                \
+		&&OPCODE_JUMP_IF_NOT_GREATER_EQUAL_INT,          \
+		&&OPCODE_JUMP_IF_NOT_EQUAL_FLOAT,                \
+		&&OPCODE_JUMP_IF_NOT_NOT_EQUAL_FLOAT,            \
+		&&OPCODE_JUMP_IF_NOT_LESS_FLOAT,                 \
+		&&OPCODE_JUMP_IF_NOT_LESS_EQUAL_FLOAT,           \
+		&&OPCODE_JUMP_IF_NOT_GREATER_FLOAT,              \
+		&&OPCODE_JUMP_IF_NOT_GREATER_EQUAL_FLOAT,        \
 		&&OPCODE_JUMP_TO_DEF_ARGUMENT,                   \
 		&&OPCODE_JUMP_IF_SHARED,                         \
 		&&OPCODE_RETURN,                                 \
@@ -377,7 +408,12 @@ void (*type_init_function_table[])(Variant *) = {
 #define OPCODES_OUT \
 	OPSOUT:
 #define OPCODE_SWITCH(m_test) goto *switch_table_ops[m_test];
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) && defined(GDSCRIPT_PROFILE_OPCODE_PAIRS)
+#define DISPATCH_OPCODE                 \
+	PROFILE_OPCODE_PAIR(_code_ptr[ip]); \
+	last_opcode = _code_ptr[ip];        \
+	goto *switch_table_ops[last_opcode]
+#elif defined(DEBUG_ENABLED)
 #define DISPATCH_OPCODE          \
 	last_opcode = _code_ptr[ip]; \
 	goto *switch_table_ops[last_opcode]
@@ -404,6 +440,14 @@ void (*type_init_function_table[])(Variant *) = {
 #define OPCODE_OUT break
 #endif
 
+#if defined(DEBUG_ENABLED) && defined(GDSCRIPT_PROFILE_OPCODE_PAIRS)
+// Opcode pair histogram, see GDSCRIPT_PROFILE_OPCODE_PAIRS.
+#define PROFILE_OPCODE_PAIR(m_next)                                                                  \
+	if (unlikely(opcode_pair_counts != nullptr && last_opcode >= 0)) {                               \
+		opcode_pair_counts[last_opcode * GDScriptLanguage::OPCODE_PAIR_STRIDE + (m_next)].increment(); \
+	}
+#endif
+
 // Helpers for VariantInternal methods in macros.
 #define OP_GET_BOOL get_bool
 #define OP_GET_INT get_int
@@ -661,6 +705,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		profile.call_count.increment();
 		profile.frame_call_count.increment();
 	}
+#ifdef GDSCRIPT_PROFILE_OPCODE_PAIRS
+	SafeNumeric<uint64_t> *opcode_pair_counts = GDScriptLanguage::get_singleton()->profiling ? GDScriptLanguage::get_singleton()->opcode_pair_counts : nullptr;
+#endif
 	bool exit_ok = false;
 	bool awaited = false;
 	int variant_address_limits[ADDR_TYPE_MAX] = { _stack_size, _constant_count, p_instance ? (int)p_instance->members.size() : 0 };
@@ -668,7 +715,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 	Variant *variant_addresses[ADDR_TYPE_MAX] = { stack, _constants_ptr, p_instance ? p_instance->members.ptrw() : nullptr };
 
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) && defined(GDSCRIPT_PROFILE_OPCODE_PAIRS)
+	int last_opcode = -1;
+	OPCODE_WHILE(ip < _code_size) {
+#if !defined(__GNUC__)
+		PROFILE_OPCODE_PAIR(_code_ptr[ip]);
+#endif
+		last_opcode = _code_ptr[ip];
+#elif defined(DEBUG_ENABLED)
 	OPCODE_WHILE(ip < _code_size) {
 		int last_opcode = _code_ptr[ip];
 #else
@@ -780,6 +834,39 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			// Same preconditions as the validated operators (operand and result types are known),
+			// but computed inline to avoid the indirect call through the evaluator.
+#define OPCODE_OPERATOR_SPECIALIZED(m_name, m_operand_get, m_result_get, m_operator)                                 \
+	OPCODE(OPCODE_OPERATOR_##m_name) {                                                                               \
+		CHECK_SPACE(4);                                                                                              \
+		GET_VARIANT_PTR(a, 0);                                                                                       \
+		GET_VARIANT_PTR(b, 1);                                                                                       \
+		GET_VARIANT_PTR(dst, 2);                                                                                     \
+		*VariantInternal::m_result_get(dst) = *VariantInternal::m_operand_get(a) m_operator *VariantInternal::m_operand_get(b); \
+		ip += 4;                                                                                                     \
+	}                                                                                                                \
+	DISPATCH_OPCODE
+
+			OPCODE_OPERATOR_SPECIALIZED(ADD_INT, get_int, get_int, +);
+			OPCODE_OPERATOR_SPECIALIZED(SUBTRACT_INT, get_int, get_int, -);
+			OPCODE_OPERATOR_SPECIALIZED(MULTIPLY_INT, get_int, get_int, *);
+			OPCODE_OPERATOR_SPECIALIZED(EQUAL_INT, get_int, get_bool, ==);
+			OPCODE_OPERATOR_SPECIALIZED(NOT_EQUAL_INT, get_int, get_bool, !=);
+			OPCODE_OPERATOR_SPECIALIZED(LESS_INT, get_int, get_bool, <);
+			OPCODE_OPERATOR_SPECIALIZED(LESS_EQUAL_INT, get_int, get_bool, <=);
+			OPCODE_OPERATOR_SPECIALIZED(GREATER_INT, get_int, get_bool, >);
+			OPCODE_OPERATOR_SPECIALIZED(GREATER_EQUAL_INT, get_int, get_bool, >=);
+			OPCODE_OPERATOR_SPECIALIZED(ADD_FLOAT, get_float, get_float, +);
+			OPCODE_OPERATOR_SPECIALIZED(SUBTRACT_FLOAT, get_float, get_float, -);
+			OPCODE_OPERATOR_SPECIALIZED(MULTIPLY_FLOAT, get_float, get_float, *);
+			OPCODE_OPERATOR_SPECIALIZED(DIVIDE_FLOAT, get_float, get_float, /);
+			OPCODE_OPERATOR_SPECIALIZED(EQUAL_FLOAT, get_float, get_bool, ==);
+			OPCODE_OPERATOR_SPECIALIZED(NOT_EQUAL_FLOAT, get_float, get_bool, !=);
+			OPCODE_OPERATOR_SPECIALIZED(LESS_FLOAT, get_float, get_bool, <);
+			OPCODE_OPERATOR_SPECIALIZED(LESS_EQUAL_FLOAT, get_float, get_bool, <=);
+			OPCODE_OPERATOR_SPECIALIZED(GREATER_FLOAT, get_float, get_bool, >);
+			OPCODE_OPERATOR_SPECIALIZED(GREATER_EQUAL_FLOAT, get_float, get_bool, >=);
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -2546,6 +2633,35 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			// Fused typed comparison and OPCODE_JUMP_IF_NOT, the boolean result is never stored.
+#define OPCODE_JUMP_IF_NOT_COMPARE(m_name, m_operand_get, m_operator)                          \
+	OPCODE(OPCODE_JUMP_IF_NOT_##m_name) {                                                       \
+		CHECK_SPACE(4);                                                                         \
+		GET_VARIANT_PTR(a, 0);                                                                  \
+		GET_VARIANT_PTR(b, 1);                                                                  \
+		if (*VariantInternal::m_operand_get(a) m_operator *VariantInternal::m_operand_get(b)) { \
+			ip += 4;                                                                            \
+		} else {                                                                                \
+			int to = _code_ptr[ip + 3];                                                         \
+			GD_ERR_BREAK(to < 0 || to > _code_size);                                            \
+			ip = to;                                                                            \
+		}                                                                                       \
+	}                                                                                           \
+	DISPATCH_OPCODE
+
+			OPCODE_JUMP_IF_NOT_COMPARE(EQUAL_INT, get_int, ==);
+			OPCODE_JUMP_IF_NOT_COMPARE(NOT_EQUAL_INT, get_int, !=);
+			OPCODE_JUMP_IF_NOT_COMPARE(LESS_INT, get_int, <);
+			OPCODE_JUMP_IF_NOT_COMPARE(LESS_EQUAL_INT, get_int, <=);
+			OPCODE_JUMP_IF_NOT_COMPARE(GREATER_INT, get_int, >);
+			OPCODE_JUMP_IF_NOT_COMPARE(GREATER_EQUAL_INT, get_int, >=);
+			OPCODE_JUMP_IF_NOT_COMPARE(EQUAL_FLOAT, get_float, ==);
+			OPCODE_JUMP_IF_NOT_COMPARE(NOT_EQUAL_FLOAT, get_float, !=);
+			OPCODE_JUMP_IF_NOT_COMPARE(LESS_FLOAT, get_float, <);
+			OPCODE_JUMP_IF_NOT_COMPARE(LESS_EQUAL_FLOAT, get_float, <=);
+			OPCODE_JUMP_IF_NOT_COMPARE(GREATER_FLOAT, get_float, >);
+			OPCODE_JUMP_IF_NOT_COMPARE(GREATER_EQUAL_FLOAT, get_float, >=);
+
 			OPCODE(OPCODE_JUMP_TO_DEF_ARGUMENT) {
 				CHECK_SPACE(2);
 				ip = _default_arg_ptr[defarg];
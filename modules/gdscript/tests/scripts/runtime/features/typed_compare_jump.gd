@@ -0,0 +1,50 @@
+# Typed comparisons used directly as conditions are fused with the conditional jump.
+
+func test():
+	var a: int = 3
+	var b: int = 5
+	if a < b:
+		print("a < b")
+	if a > b:
+		print("unexpected")
+	elif a == 3:
+		print("a == 3")
+	else:
+		print("unexpected")
+
+	var count: int = 0
+	while count < 4:
+		count += 1
+	print(count)
+
+	var x: float = 0.0
+	while x <= 1.0:
+		x += 0.25
+	print(x)
+
+	var nan: float = NAN
+	if nan == nan:
+		print("unexpected")
+	else:
+		print("nan is not equal to itself")
+	if nan != nan:
+		print("nan is different from itself")
+
+	# The comparison result is still available when it is stored.
+	var less: bool = a < b
+	if less:
+		print(less)
+
+	var found: int = -1
+	for i in 10:
+		var value: int = i * i
+		if value >= 20:
+			found = i
+			break
+	print(found)
+
+	match a:
+		3 when b > a:
+			print("match guard")
+		_:
+			print("unexpected")
@@ -0,0 +1,32 @@
+# Typed int and float operands use specialized opcodes, they must behave like the generic operators.
+
+func test():
+	var a: int = 7
+	var b: int = -3
+	print(a + b, " ", a - b, " ", a * b)
+	print(a == b, " ", a != b, " ", a < b, " ", a <= b, " ", a > b, " ", a >= b)
+	print(a == 7, " ", a <= 7, " ", a >= 7)
+
+	var x: float = 2.5
+	var y: float = -0.5
+	print(x + y, " ", x - y, " ", x * y, " ", x / y)
+	print(x == y, " ", x != y, " ", x < y, " ", x <= y, " ", x > y, " ", x >= y)
+	var zero: float = 0.0
+	print(x / zero, " ", y / zero)
+
+	var nan: float = NAN
+	print(nan == nan, " ", nan != nan, " ", nan < 1.0, " ", nan >= 1.0)
+
+	# Untyped operands still go through the generic path.
+	var u = 7
+	var v = 2.0
+	print(u + v, " ", u < v)
+
+	var sum: int = 0
+	var total: float = 0.0
+	for i in 10:
+		var j: int = i
+		if j < 5:
+			sum = sum + j * j
+		total = total + 0.5
+	print(sum, " ", total)
@@ -271,6 +271,9 @@ real_t FORWARD_1_C(map_get_cell_size, RID, p_map, rid_to_rid);
 void FORWARD_2(map_set_use_edge_connections, RID, p_map, bool, p_enabled, rid_to_rid, bool_to_bool);
 bool FORWARD_1_C(map_get_use_edge_connections, RID, p_map, rid_to_rid);
 
+void FORWARD_2(map_set_use_hierarchical_pathfinding, RID, p_map, bool, p_enabled, rid_to_rid, bool_to_bool);
+bool FORWARD_1_C(map_get_use_hierarchical_pathfinding, RID, p_map, rid_to_rid);
+
 void FORWARD_2(map_set_edge_connection_margin, RID, p_map, real_t, p_connection_margin, rid_to_rid, real_to_real);
 real_t FORWARD_1_C(map_get_edge_connection_margin, RID, p_map, rid_to_rid);
 
@@ -461,6 +464,38 @@ void GodotNavigationServer2D::query_path(const Ref<NavigationPathQueryParameters
 	p_query_result->set_path_types(_query_result.path_types);
 	p_query_result->set_path_rids(_query_result.path_rids);
 	p_query_result->set_path_owner_ids(_query_result.path_owner_ids);
+	p_query_result->set_expanded_polygon_count(_query_result.expanded_polygon_count);
+}
+
+static void query_path_batch_completed(const LocalVector<NavigationUtilities::PathQueryResult> &p_results, const Callable &p_callback) {
+	TypedArray<NavigationPathQueryResult2D> results;
+	results.resize(p_results.size());
+	for (uint32_t i = 0; i < p_results.size(); i++) {
+		Ref<NavigationPathQueryResult2D> query_result;
+		query_result.instantiate();
+		query_result->set_path(vector_v3_to_v2(p_results[i].path));
+		query_result->set_path_types(p_results[i].path_types);
+		query_result->set_path_rids(p_results[i].path_rids);
+		query_result->set_path_owner_ids(p_results[i].path_owner_ids);
+		query_result->set_expanded_polygon_count(p_results[i].expanded_polygon_count);
+		results[i] = query_result;
+	}
+
+	p_callback.call(results);
+}
+
+void GodotNavigationServer2D::query_path_batch(const TypedArray<NavigationPathQueryParameters2D> &p_query_parameters, const Callable &p_callback) {
+	ERR_FAIL_COND(!p_callback.is_valid());
+
+	LocalVector<NavigationUtilities::PathQueryParameters> parameters;
+	parameters.resize(p_query_parameters.size());
+	for (uint32_t i = 0; i < parameters.size(); i++) {
+		const Ref<NavigationPathQueryParameters2D> query_parameters = p_query_parameters[i];
+		ERR_FAIL_COND(!query_parameters.is_valid());
+		parameters[i] = query_parameters->get_parameters();
+	}
+
+	NavigationServer3D::get_singleton()->_query_path_batch(parameters, &query_path_batch_completed, p_callback);
 }
 
 RID GodotNavigationServer2D::source_geometry_parser_create() {
@@ -64,6 +64,8 @@ public:
 	virtual real_t map_get_cell_size(RID p_map) const override;
 	virtual void map_set_use_edge_connections(RID p_map, bool p_enabled) override;
 	virtual bool map_get_use_edge_connections(RID p_map) const override;
+	virtual void map_set_use_hierarchical_pathfinding(RID p_map, bool p_enabled) override;
+	virtual bool map_get_use_hierarchical_pathfinding(RID p_map) const override;
 	virtual void map_set_edge_connection_margin(RID p_map, real_t p_connection_margin) override;
 	virtual real_t map_get_edge_connection_margin(RID p_map) const override;
 	virtual void map_set_link_connection_radius(RID p_map, real_t p_connection_radius) override;
@@ -242,6 +244,7 @@ public:
 	virtual uint32_t obstacle_get_avoidance_layers(RID p_obstacle) const override;
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result) const override;
+	virtual void query_path_batch(const TypedArray<NavigationPathQueryParameters2D> &p_query_parameters, const Callable &p_callback) override;
 
 	virtual void init() override;
 	virtual void sync() override;
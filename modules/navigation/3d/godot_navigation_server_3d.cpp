@@ -209,6 +209,20 @@ bool GodotNavigationServer3D::map_get_use_edge_connections(RID p_map) const {
 	return map->get_use_edge_connections();
 }
 
+COMMAND_2(map_set_use_hierarchical_pathfinding, RID, p_map, bool, p_enabled) {
+	NavMap *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_use_hierarchical_pathfinding(p_enabled);
+}
+
+bool GodotNavigationServer3D::map_get_use_hierarchical_pathfinding(RID p_map) const {
+	NavMap *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, false);
+
+	return map->get_use_hierarchical_pathfinding();
+}
+
 COMMAND_2(map_set_edge_connection_margin, RID, p_map, real_t, p_connection_margin) {
 	NavMap *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL(map);
@@ -1131,6 +1145,26 @@ void GodotNavigationServer3D::bake_from_source_geometry_data_async(const Ref<Nav
 #endif // _3D_DISABLED
 }
 
+void GodotNavigationServer3D::bake_tiles_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback) {
+#ifndef _3D_DISABLED
+	ERR_FAIL_COND_MSG(!p_navigation_mesh.is_valid(), "Invalid navigation mesh.");
+	ERR_FAIL_COND_MSG(!p_source_geometry_data.is_valid(), "Invalid NavigationMeshSourceGeometryData3D.");
+
+	ERR_FAIL_NULL(NavMeshGenerator3D::get_singleton());
+	NavMeshGenerator3D::get_singleton()->bake_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_callback, p_dirty_aabb);
+#endif // _3D_DISABLED
+}
+
+void GodotNavigationServer3D::bake_tiles_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback) {
+#ifndef _3D_DISABLED
+	ERR_FAIL_COND_MSG(!p_navigation_mesh.is_valid(), "Invalid navigation mesh.");
+	ERR_FAIL_COND_MSG(!p_source_geometry_data.is_valid(), "Invalid NavigationMeshSourceGeometryData3D.");
+
+	ERR_FAIL_NULL(NavMeshGenerator3D::get_singleton());
+	NavMeshGenerator3D::get_singleton()->bake_from_source_geometry_data_async(p_navigation_mesh, p_source_geometry_data, p_callback, p_dirty_aabb);
+#endif // _3D_DISABLED
+}
+
 bool GodotNavigationServer3D::is_baking_navigation_mesh(Ref<NavigationMesh> p_navigation_mesh) const {
 #ifdef _3D_DISABLED
 	return false;
@@ -1263,6 +1297,8 @@ void GodotNavigationServer3D::map_force_update(RID p_map) {
 	NavMap *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL(map);
 
+	_finish_path_query_batches();
+
 	flush_queries();
 
 	map->sync();
@@ -1284,9 +1320,14 @@ void GodotNavigationServer3D::sync() {
 }
 
 void GodotNavigationServer3D::process(real_t p_delta_time) {
+	// The path query batches started in the previous process read the maps, so they need to finish before any change is applied.
+	_finish_path_query_batches();
+
 	flush_queries();
 
 	if (!active) {
+		// The maps are not synchronized while inactive, so the queued batches run against them as they are.
+		_start_path_query_batches();
 		return;
 	}
 
@@ -1332,6 +1373,8 @@ void GodotNavigationServer3D::process(real_t p_delta_time) {
 	pm_edge_merge_count = _new_pm_edge_merge_count;
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
+
+	_start_path_query_batches();
 }
 
 void GodotNavigationServer3D::init() {
@@ -1341,6 +1384,15 @@ void GodotNavigationServer3D::init() {
 }
 
 void GodotNavigationServer3D::finish() {
+	_finish_path_query_batches();
+	{
+		MutexLock lock(path_query_batches_mutex);
+		for (PathQueryBatch *batch : queued_path_query_batches) {
+			memdelete(batch);
+		}
+		queued_path_query_batches.clear();
+	}
+
 	flush_queries();
 #ifndef _3D_DISABLED
 	if (navmesh_generator_3d) {
@@ -1352,33 +1404,127 @@ void GodotNavigationServer3D::finish() {
 }
 
 PathQueryResult GodotNavigationServer3D::_query_path(const PathQueryParameters &p_parameters) const {
-	PathQueryResult r_query_result;
-
 	const NavMap *map = map_owner.get_or_null(p_parameters.map);
-	ERR_FAIL_NULL_V(map, r_query_result);
+	ERR_FAIL_NULL_V(map, PathQueryResult());
+
+	return _query_path_on_map(map, p_parameters);
+}
+
+static void query_path_batch_completed(const LocalVector<NavigationUtilities::PathQueryResult> &p_results, const Callable &p_callback) {
+	TypedArray<NavigationPathQueryResult3D> results;
+	results.resize(p_results.size());
+	for (uint32_t i = 0; i < p_results.size(); i++) {
+		Ref<NavigationPathQueryResult3D> query_result;
+		query_result.instantiate();
+		query_result->set_path(p_results[i].path);
+		query_result->set_path_types(p_results[i].path_types);
+		query_result->set_path_rids(p_results[i].path_rids);
+		query_result->set_path_owner_ids(p_results[i].path_owner_ids);
+		query_result->set_expanded_polygon_count(p_results[i].expanded_polygon_count);
+		results[i] = query_result;
+	}
+
+	p_callback.call(results);
+}
+
+void GodotNavigationServer3D::query_path_batch(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const Callable &p_callback) {
+	ERR_FAIL_COND(!p_callback.is_valid());
+
+	LocalVector<NavigationUtilities::PathQueryParameters> parameters;
+	parameters.resize(p_query_parameters.size());
+	for (uint32_t i = 0; i < parameters.size(); i++) {
+		const Ref<NavigationPathQueryParameters3D> query_parameters = p_query_parameters[i];
+		ERR_FAIL_COND(!query_parameters.is_valid());
+		parameters[i] = query_parameters->get_parameters();
+	}
+
+	_query_path_batch(parameters, &query_path_batch_completed, p_callback);
+}
+
+void GodotNavigationServer3D::_query_path_batch(const LocalVector<PathQueryParameters> &p_parameters, PathQueryBatchCompletedCallback p_completed_callback, const Callable &p_callback) {
+	ERR_FAIL_NULL(p_completed_callback);
+
+	PathQueryBatch *batch = memnew(PathQueryBatch);
+	batch->parameters = p_parameters;
+	batch->completed_callback = p_completed_callback;
+	batch->callback = p_callback;
+
+	MutexLock lock(path_query_batches_mutex);
+	queued_path_query_batches.push_back(batch);
+}
+
+void GodotNavigationServer3D::_start_path_query_batches() {
+	MutexLock lock(path_query_batches_mutex);
+
+	for (PathQueryBatch *batch : queued_path_query_batches) {
+		const uint32_t query_count = batch->parameters.size();
+
+		// Resolve the maps here, the map owner must not be accessed from the worker threads.
+		batch->maps.resize(query_count);
+		for (uint32_t i = 0; i < query_count; i++) {
+			batch->maps[i] = map_owner.get_or_null(batch->parameters[i].map);
+		}
+		batch->results.resize(query_count);
+
+		if (query_count > 0) {
+			batch->group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotNavigationServer3D::_process_path_query_batch_element, batch, query_count, -1, false, SNAME("NavigationPathQueryBatch"));
+		}
+		running_path_query_batches.push_back(batch);
+	}
+	queued_path_query_batches.clear();
+}
+
+void GodotNavigationServer3D::_finish_path_query_batches() {
+	LocalVector<PathQueryBatch *> finished_batches;
+	{
+		MutexLock lock(path_query_batches_mutex);
+		finished_batches = running_path_query_batches;
+		running_path_query_batches.clear();
+	}
+
+	for (PathQueryBatch *batch : finished_batches) {
+		if (batch->group_task != -1) {
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(batch->group_task);
+		}
+		batch->completed_callback(batch->results, batch->callback);
+		memdelete(batch);
+	}
+}
+
+void GodotNavigationServer3D::_process_path_query_batch_element(uint32_t p_index, PathQueryBatch *p_batch) {
+	const NavMap *map = p_batch->maps[p_index];
+	ERR_FAIL_NULL(map);
+
+	p_batch->results[p_index] = _query_path_on_map(map, p_batch->parameters[p_index]);
+}
+
+PathQueryResult GodotNavigationServer3D::_query_path_on_map(const NavMap *p_map, const PathQueryParameters &p_parameters) const {
+	PathQueryResult r_query_result;
 
 	// run the pathfinding
 
 	if (p_parameters.pathfinding_algorithm == PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR) {
 		// while postprocessing is still part of map.get_path() need to check and route it here for the correct "optimize" post-processing
 		if (p_parameters.path_postprocessing == PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL) {
-			r_query_result.path = map->get_path(
+			r_query_result.path = p_map->get_path(
 					p_parameters.start_position,
 					p_parameters.target_position,
 					true,
 					p_parameters.navigation_layers,
 					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_TYPES) ? &r_query_result.path_types : nullptr,
 					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_RIDS) ? &r_query_result.path_rids : nullptr,
-					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_OWNERS) ? &r_query_result.path_owner_ids : nullptr);
+					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_OWNERS) ? &r_query_result.path_owner_ids : nullptr,
+					&r_query_result.expanded_polygon_count);
 		} else if (p_parameters.path_postprocessing == PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED) {
-			r_query_result.path = map->get_path(
+			r_query_result.path = p_map->get_path(
 					p_parameters.start_position,
 					p_parameters.target_position,
 					false,
 					p_parameters.navigation_layers,
 					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_TYPES) ? &r_query_result.path_types : nullptr,
 					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_RIDS) ? &r_query_result.path_rids : nullptr,
-					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_OWNERS) ? &r_query_result.path_owner_ids : nullptr);
+					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_OWNERS) ? &r_query_result.path_owner_ids : nullptr,
+					&r_query_result.expanded_polygon_count);
 		}
 	} else {
 		return r_query_result;
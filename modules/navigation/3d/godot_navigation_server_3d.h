@@ -82,6 +82,21 @@ class GodotNavigationServer3D : public NavigationServer3D {
 	LocalVector<NavMap *> active_maps;
 	LocalVector<uint32_t> active_maps_iteration_id;
 
+	struct PathQueryBatch {
+		LocalVector<NavigationUtilities::PathQueryParameters> parameters;
+		LocalVector<const NavMap *> maps;
+		LocalVector<NavigationUtilities::PathQueryResult> results;
+		PathQueryBatchCompletedCallback completed_callback = nullptr;
+		Callable callback;
+		WorkerThreadPool::GroupID group_task = -1;
+	};
+
+	/// Path query batches are queued until the maps are synchronized, then run on the
+	/// WorkerThreadPool until the start of the next process where their callbacks are called.
+	Mutex path_query_batches_mutex;
+	LocalVector<PathQueryBatch *> queued_path_query_batches;
+	LocalVector<PathQueryBatch *> running_path_query_batches;
+
 #ifndef _3D_DISABLED
 	NavMeshGenerator3D *navmesh_generator_3d = nullptr;
 #endif // _3D_DISABLED
@@ -123,6 +138,9 @@ public:
 	COMMAND_2(map_set_use_edge_connections, RID, p_map, bool, p_enabled);
 	virtual bool map_get_use_edge_connections(RID p_map) const override;
 
+	COMMAND_2(map_set_use_hierarchical_pathfinding, RID, p_map, bool, p_enabled);
+	virtual bool map_get_use_hierarchical_pathfinding(RID p_map) const override;
+
 	COMMAND_2(map_set_edge_connection_margin, RID, p_map, real_t, p_connection_margin);
 	virtual real_t map_get_edge_connection_margin(RID p_map) const override;
 
@@ -262,6 +280,8 @@ public:
 	virtual void parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable()) override;
 	virtual void bake_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) override;
 	virtual void bake_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) override;
+	virtual void bake_tiles_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback = Callable()) override;
+	virtual void bake_tiles_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback = Callable()) override;
 	virtual bool is_baking_navigation_mesh(Ref<NavigationMesh> p_navigation_mesh) const override;
 
 	virtual RID source_geometry_parser_create() override;
@@ -285,12 +305,20 @@ public:
 	virtual void finish() override;
 
 	virtual NavigationUtilities::PathQueryResult _query_path(const NavigationUtilities::PathQueryParameters &p_parameters) const override;
+	virtual void query_path_batch(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const Callable &p_callback) override;
+	virtual void _query_path_batch(const LocalVector<NavigationUtilities::PathQueryParameters> &p_parameters, PathQueryBatchCompletedCallback p_completed_callback, const Callable &p_callback) override;
 
 	int get_process_info(ProcessInfo p_info) const override;
 
 private:
 	void internal_free_agent(RID p_object);
 	void internal_free_obstacle(RID p_object);
+
+	NavigationUtilities::PathQueryResult _query_path_on_map(const NavMap *p_map, const NavigationUtilities::PathQueryParameters &p_parameters) const;
+
+	void _start_path_query_batches();
+	void _finish_path_query_batches();
+	void _process_path_query_batch_element(uint32_t p_index, PathQueryBatch *p_batch);
 };
 
 #undef COMMAND_1
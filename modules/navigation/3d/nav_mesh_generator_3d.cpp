@@ -35,6 +35,7 @@
 #include "core/config/project_settings.h"
 #include "core/math/convex_hull.h"
 #include "core/os/thread.h"
+#include "core/templates/sort_array.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/3d/multimesh_instance_3d.h"
 #include "scene/3d/navigation_obstacle_3d.h"
@@ -171,7 +172,7 @@ void NavMeshGenerator3D::parse_source_geometry_data(Ref<NavigationMesh> p_naviga
 	}
 }
 
-void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback) {
+void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback, const AABB &p_dirty_aabb) {
 	ERR_FAIL_COND(!p_navigation_mesh.is_valid());
 	ERR_FAIL_COND(!p_source_geometry_data.is_valid());
 
@@ -190,7 +191,7 @@ void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_na
 	baking_navmeshes.insert(p_navigation_mesh);
 	baking_navmesh_mutex.unlock();
 
-	generator_bake_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data);
+	generator_bake_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_dirty_aabb);
 
 	baking_navmesh_mutex.lock();
 	baking_navmeshes.erase(p_navigation_mesh);
@@ -201,7 +202,7 @@ void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_na
 	}
 }
 
-void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback) {
+void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback, const AABB &p_dirty_aabb) {
 	ERR_FAIL_COND(!p_navigation_mesh.is_valid());
 	ERR_FAIL_COND(!p_source_geometry_data.is_valid());
 
@@ -214,7 +215,7 @@ void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh
 	}
 
 	if (!use_threads) {
-		bake_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_callback);
+		bake_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_callback, p_dirty_aabb);
 		return;
 	}
 
@@ -231,6 +232,7 @@ void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh
 	generator_task->navigation_mesh = p_navigation_mesh;
 	generator_task->source_geometry_data = p_source_geometry_data;
 	generator_task->callback = p_callback;
+	generator_task->dirty_aabb = p_dirty_aabb;
 	generator_task->status = NavMeshGeneratorTask3D::TaskStatus::BAKING_STARTED;
 	generator_task->thread_task_id = WorkerThreadPool::get_singleton()->add_native_task(&NavMeshGenerator3D::generator_thread_bake, generator_task, NavMeshGenerator3D::baking_use_high_priority_threads, SNAME("NavMeshGeneratorBake3D"));
 	generator_tasks.insert(generator_task->thread_task_id, generator_task);
@@ -247,7 +249,7 @@ bool NavMeshGenerator3D::is_baking(Ref<NavigationMesh> p_navigation_mesh) {
 void NavMeshGenerator3D::generator_thread_bake(void *p_arg) {
 	NavMeshGeneratorTask3D *generator_task = static_cast<NavMeshGeneratorTask3D *>(p_arg);
 
-	generator_bake_from_source_geometry_data(generator_task->navigation_mesh, generator_task->source_geometry_data);
+	generator_bake_from_source_geometry_data(generator_task->navigation_mesh, generator_task->source_geometry_data, generator_task->dirty_aabb);
 
 	generator_task->status = NavMeshGeneratorTask3D::TaskStatus::BAKING_FINISHED;
 }
@@ -667,7 +669,7 @@ void NavMeshGenerator3D::generator_parse_source_geometry_data(const Ref<Navigati
 	}
 };
 
-void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data) {
+void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb) {
 	if (p_navigation_mesh.is_null() || p_source_geometry_data.is_null()) {
 		return;
 	}
@@ -679,13 +681,6 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		return;
 	}
 
-	rcHeightfield *hf = nullptr;
-	rcCompactHeightfield *chf = nullptr;
-	rcContourSet *cset = nullptr;
-	rcPolyMesh *poly_mesh = nullptr;
-	rcPolyMeshDetail *detail_mesh = nullptr;
-	rcContext ctx;
-
 	// added to keep track of steps, no functionality right now
 	String bake_state = "";
 
@@ -693,8 +688,6 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 
 	const float *verts = vertices.ptr();
 	const int nverts = vertices.size() / 3;
-	const int *tris = indices.ptr();
-	const int ntris = indices.size() / 3;
 
 	float bmin[3], bmax[3];
 	rcCalcBounds(verts, nverts, bmin, bmax);
@@ -765,6 +758,11 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		cfg.bmax[2] = cfg.bmin[2] + baking_aabb.size[2];
 	}
 
+	if (p_navigation_mesh->get_tile_size() > 0.0) {
+		generator_bake_tiles_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, cfg, p_dirty_aabb);
+		return;
+	}
+
 	bake_state = "Calculating grid size..."; // step #2
 	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
 
@@ -779,41 +777,401 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		return;
 	}
 
+	Vector<Vector3> nav_vertices;
+	LocalVector<Vector<int>> nav_polygons;
+	if (!generator_bake_polygons(p_navigation_mesh, p_source_geometry_data, indices, cfg, nav_vertices, nav_polygons)) {
+		return;
+	}
+
+	p_navigation_mesh->set_vertices(nav_vertices);
+	p_navigation_mesh->clear_polygons();
+	for (const Vector<int> &nav_polygon : nav_polygons) {
+		p_navigation_mesh->add_polygon(nav_polygon);
+	}
+
+	bake_state = "Baking finished."; // step #12
+}
+
+struct NavMeshGenerator3D::NavMeshGeneratorTile3D {
+	Ref<NavigationMesh> navigation_mesh;
+	Ref<NavigationMeshSourceGeometryData3D> source_geometry_data;
+	rcConfig cfg;
+	// The source geometry triangles overlapping the tile and its border.
+	Vector<int> indices;
+	Vector<Vector3> vertices;
+	LocalVector<Vector<int>> polygons;
+};
+
+void NavMeshGenerator3D::generator_thread_bake_tile(void *p_arg) {
+	NavMeshGeneratorTile3D *tile = static_cast<NavMeshGeneratorTile3D *>(p_arg);
+
+	if (tile->indices.is_empty()) {
+		return;
+	}
+
+	generator_bake_polygons(tile->navigation_mesh, tile->source_geometry_data, tile->indices, tile->cfg, tile->vertices, tile->polygons);
+}
+
+// Joins the polygons of the baked tiles. The vertices on the tile borders are merged, and the polygon
+// edges on the tile borders are split at the vertices of the neighbor tiles, so the neighbor polygons share their edges.
+struct NavMeshTileStitcher3D {
+	static const int NO_TILE_BORDER = INT32_MIN;
+
+	struct BorderVertexComparator {
+		const Vector3 *vertices = nullptr;
+		int axis = 0;
+
+		_FORCE_INLINE_ bool operator()(int p_a, int p_b) const {
+			return vertices[p_a][axis] < vertices[p_b][axis];
+		}
+	};
+
+	real_t tile_size = 0.0;
+	real_t cell_size = 0.0;
+	real_t cell_height = 0.0;
+
+	LocalVector<Vector3> vertices;
+	LocalVector<Vector<int>> polygons;
+
+	/// Tile border the vertices are on, along the X and the Z axis.
+	LocalVector<int> vertex_border_x;
+	LocalVector<int> vertex_border_z;
+
+	HashMap<Vector2i, LocalVector<int>> border_cell_vertices;
+	HashMap<int, LocalVector<int>> border_x_vertices;
+	HashMap<int, LocalVector<int>> border_z_vertices;
+
+	int add_vertex(const Vector3 &p_vertex) {
+		const real_t epsilon = cell_size * 0.01;
+		const int border_x = (int)Math::round(p_vertex.x / tile_size);
+		const int border_z = (int)Math::round(p_vertex.z / tile_size);
+		const bool on_border_x = Math::abs(p_vertex.x - border_x * tile_size) < epsilon;
+		const bool on_border_z = Math::abs(p_vertex.z - border_z * tile_size) < epsilon;
+
+		if (on_border_x || on_border_z) {
+			// Both tiles bake the same vertices on their shared border, up to the precision of the height sampling.
+			LocalVector<int> &cell_vertices = border_cell_vertices[Vector2i((int)Math::round(p_vertex.x / cell_size), (int)Math::round(p_vertex.z / cell_size))];
+			for (int index : cell_vertices) {
+				if (Math::abs(vertices[index].y - p_vertex.y) <= cell_height) {
+					return index;
+				}
+			}
+			cell_vertices.push_back(vertices.size());
+		}
+
+		const int index = vertices.size();
+		vertices.push_back(p_vertex);
+		vertex_border_x.push_back(on_border_x ? border_x : NO_TILE_BORDER);
+		vertex_border_z.push_back(on_border_z ? border_z : NO_TILE_BORDER);
+		if (on_border_x) {
+			border_x_vertices[border_x].push_back(index);
+		}
+		if (on_border_z) {
+			border_z_vertices[border_z].push_back(index);
+		}
+		return index;
+	}
+
+	void add_polygon(const Vector<Vector3> &p_vertices, const Vector<int> &p_polygon, LocalVector<int> &r_vertex_map) {
+		Vector<int> polygon;
+		polygon.resize(p_polygon.size());
+		for (int i = 0; i < p_polygon.size(); i++) {
+			const int vertex = p_polygon[i];
+			ERR_FAIL_INDEX(vertex, p_vertices.size());
+			if (r_vertex_map[vertex] == -1) {
+				r_vertex_map[vertex] = add_vertex(p_vertices[vertex]);
+			}
+			polygon.write[i] = r_vertex_map[vertex];
+		}
+		polygons.push_back(polygon);
+	}
+
+	void insert_border_vertices(const LocalVector<int> &p_border_vertices, int p_axis, int p_from, int p_to, Vector<int> &r_polygon) const {
+		const real_t epsilon = cell_size * 0.01;
+		const real_t from = vertices[p_from][p_axis];
+		const real_t to = vertices[p_to][p_axis];
+		const real_t begin = MIN(from, to) + epsilon;
+		const real_t end = MAX(from, to) - epsilon;
+
+		// Find the first vertex after the edge start, the border vertices are sorted along the border.
+		uint32_t low = 0;
+		uint32_t high = p_border_vertices.size();
+		while (low < high) {
+			const uint32_t middle = (low + high) / 2;
+			if (vertices[p_border_vertices[middle]][p_axis] <= begin) {
+				low = middle + 1;
+			} else {
+				high = middle;
+			}
+		}
+		high = low;
+		while (high < p_border_vertices.size() && vertices[p_border_vertices[high]][p_axis] < end) {
+			high++;
+		}
+
+		if (from < to) {
+			for (uint32_t i = low; i < high; i++) {
+				r_polygon.push_back(p_border_vertices[i]);
+			}
+		} else {
+			for (uint32_t i = high; i > low; i--) {
+				r_polygon.push_back(p_border_vertices[i - 1]);
+			}
+		}
+	}
+
+	void split_border_edges() {
+		SortArray<int, BorderVertexComparator> sorter;
+		sorter.compare.vertices = vertices.ptr();
+		sorter.compare.axis = Vector3::AXIS_Z;
+		for (KeyValue<int, LocalVector<int>> &E : border_x_vertices) {
+			sorter.sort(E.value.ptr(), E.value.size());
+		}
+		sorter.compare.axis = Vector3::AXIS_X;
+		for (KeyValue<int, LocalVector<int>> &E : border_z_vertices) {
+			sorter.sort(E.value.ptr(), E.value.size());
+		}
+
+		for (Vector<int> &polygon : polygons) {
+			Vector<int> split_polygon;
+			for (int i = 0; i < polygon.size(); i++) {
+				const int from = polygon[i];
+				const int to = polygon[(i + 1) % polygon.size()];
+				split_polygon.push_back(from);
+				if (vertex_border_x[from] != NO_TILE_BORDER && vertex_border_x[from] == vertex_border_x[to]) {
+					insert_border_vertices(border_x_vertices[vertex_border_x[from]], Vector3::AXIS_Z, from, to, split_polygon);
+				} else if (vertex_border_z[from] != NO_TILE_BORDER && vertex_border_z[from] == vertex_border_z[to]) {
+					insert_border_vertices(border_z_vertices[vertex_border_z[from]], Vector3::AXIS_X, from, to, split_polygon);
+				}
+			}
+			if (split_polygon.size() != polygon.size()) {
+				polygon = split_polygon;
+			}
+		}
+	}
+};
+
+void NavMeshGenerator3D::generator_bake_tiles_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const rcConfig &p_cfg, const AABB &p_dirty_aabb) {
+	// The tiles are aligned on the world origin, so the same tiles are found again when the source geometry changes.
+	const int tile_cells = MAX(1, (int)Math::ceil(p_navigation_mesh->get_tile_size() / p_cfg.cs));
+	const float tile_size = tile_cells * p_cfg.cs;
+	// Each tile is baked with a border, so it is eroded and partitioned like its neighbors on the shared edges.
+	const int tile_border = p_cfg.walkableRadius + 3;
+
+	// The baking bounds are the source geometry bounds, or the filter_baking_aabb. They are snapped outwards to the
+	// world aligned cell grid, so the cells of the tiles on the edges still end on the shared tile borders.
+	const Vector2i cell_min((int)Math::floor(p_cfg.bmin[0] / p_cfg.cs), (int)Math::floor(p_cfg.bmin[2] / p_cfg.cs));
+	const Vector2i cell_max((int)Math::ceil(p_cfg.bmax[0] / p_cfg.cs), (int)Math::ceil(p_cfg.bmax[2] / p_cfg.cs));
+
+	const Vector2i tile_min((int)Math::floor(cell_min.x / (float)tile_cells), (int)Math::floor(cell_min.y / (float)tile_cells));
+	const Vector2i tile_max((int)Math::floor(cell_max.x / (float)tile_cells), (int)Math::floor(cell_max.y / (float)tile_cells));
+
+	// Only the tiles which can be affected by the dirty area are baked again, if there are polygons to keep from a previous bake.
+	const bool bake_all_tiles = !p_dirty_aabb.has_surface() || p_navigation_mesh->get_polygon_count() == 0;
+	const Rect2 dirty_rect = Rect2(p_dirty_aabb.position.x, p_dirty_aabb.position.z, p_dirty_aabb.size.x, p_dirty_aabb.size.z).grow(tile_border * p_cfg.cs);
+
+	LocalVector<NavMeshGeneratorTile3D> tiles;
+	HashSet<Vector2i> baked_tiles;
+	// Index of each tile to bake in the tile range, or -1.
+	const Vector2i tile_count = tile_max - tile_min + Vector2i(1, 1);
+	LocalVector<int> tile_indices;
+	tile_indices.resize(tile_count.x * tile_count.y);
+	for (int z = tile_min.y; z <= tile_max.y; z++) {
+		for (int x = tile_min.x; x <= tile_max.x; x++) {
+			const int tile_index = (z - tile_min.y) * tile_count.x + (x - tile_min.x);
+			tile_indices[tile_index] = -1;
+
+			// The tiles on the edges are clipped to the baking bounds.
+			const Vector2i tile_cell_begin(MAX(x * tile_cells, cell_min.x), MAX(z * tile_cells, cell_min.y));
+			const Vector2i tile_cell_end(MIN((x + 1) * tile_cells, cell_max.x), MIN((z + 1) * tile_cells, cell_max.y));
+			if (tile_cell_begin.x >= tile_cell_end.x || tile_cell_begin.y >= tile_cell_end.y) {
+				continue;
+			}
+			const Rect2 tile_rect(tile_cell_begin.x * p_cfg.cs, tile_cell_begin.y * p_cfg.cs, (tile_cell_end.x - tile_cell_begin.x) * p_cfg.cs, (tile_cell_end.y - tile_cell_begin.y) * p_cfg.cs);
+			if (!bake_all_tiles && !tile_rect.intersects(dirty_rect, true)) {
+				continue;
+			}
+			baked_tiles.insert(Vector2i(x, z));
+
+			NavMeshGeneratorTile3D tile;
+			tile.navigation_mesh = p_navigation_mesh;
+			tile.source_geometry_data = p_source_geometry_data;
+			tile.cfg = p_cfg;
+			tile.cfg.borderSize = tile_border;
+			tile.cfg.width = tile_cell_end.x - tile_cell_begin.x + tile_border * 2;
+			tile.cfg.height = tile_cell_end.y - tile_cell_begin.y + tile_border * 2;
+			tile.cfg.bmin[0] = (tile_cell_begin.x - tile_border) * p_cfg.cs;
+			tile.cfg.bmin[2] = (tile_cell_begin.y - tile_border) * p_cfg.cs;
+			tile.cfg.bmax[0] = tile.cfg.bmin[0] + tile.cfg.width * p_cfg.cs;
+			tile.cfg.bmax[2] = tile.cfg.bmin[2] + tile.cfg.height * p_cfg.cs;
+			tile_indices[tile_index] = tiles.size();
+			tiles.push_back(tile);
+		}
+	}
+
+	// Give each tile only the triangles overlapping it and its border, instead of rasterizing all of them in every tile.
+	{
+		const Vector<float> &vertices = p_source_geometry_data->get_vertices();
+		const Vector<int> &indices = p_source_geometry_data->get_indices();
+		const float *verts = vertices.ptr();
+		const int nverts = vertices.size() / 3;
+		const real_t border = tile_border * p_cfg.cs;
+
+		for (int i = 0; i + 2 < indices.size(); i += 3) {
+			float tri_min[2] = { FLT_MAX, FLT_MAX };
+			float tri_max[2] = { -FLT_MAX, -FLT_MAX };
+			bool valid_triangle = true;
+			for (int j = 0; j < 3; j++) {
+				const int vertex = indices[i + j];
+				if (vertex < 0 || vertex >= nverts) {
+					valid_triangle = false;
+					break;
+				}
+				tri_min[0] = MIN(tri_min[0], verts[vertex * 3 + 0]);
+				tri_min[1] = MIN(tri_min[1], verts[vertex * 3 + 2]);
+				tri_max[0] = MAX(tri_max[0], verts[vertex * 3 + 0]);
+				tri_max[1] = MAX(tri_max[1], verts[vertex * 3 + 2]);
+			}
+			ERR_CONTINUE(!valid_triangle);
+
+			const int x_begin = MAX(tile_min.x, (int)Math::floor((tri_min[0] - border) / tile_size));
+			const int x_end = MIN(tile_max.x, (int)Math::floor((tri_max[0] + border) / tile_size));
+			const int z_begin = MAX(tile_min.y, (int)Math::floor((tri_min[1] - border) / tile_size));
+			const int z_end = MIN(tile_max.y, (int)Math::floor((tri_max[1] + border) / tile_size));
+			for (int z = z_begin; z <= z_end; z++) {
+				for (int x = x_begin; x <= x_end; x++) {
+					const int tile_index = tile_indices[(z - tile_min.y) * tile_count.x + (x - tile_min.x)];
+					if (tile_index == -1) {
+						continue;
+					}
+					NavMeshGeneratorTile3D &tile = tiles[tile_index];
+					if (tri_max[0] < tile.cfg.bmin[0] || tri_min[0] > tile.cfg.bmax[0] || tri_max[1] < tile.cfg.bmin[2] || tri_min[1] > tile.cfg.bmax[2]) {
+						continue;
+					}
+					tile.indices.push_back(indices[i]);
+					tile.indices.push_back(indices[i + 1]);
+					tile.indices.push_back(indices[i + 2]);
+				}
+			}
+		}
+	}
+
+	if (use_threads && tiles.size() > 1) {
+		LocalVector<WorkerThreadPool::TaskID> tile_task_ids;
+		tile_task_ids.resize(tiles.size());
+		for (uint32_t i = 0; i < tiles.size(); i++) {
+			tile_task_ids[i] = WorkerThreadPool::get_singleton()->add_native_task(&NavMeshGenerator3D::generator_thread_bake_tile, &tiles[i], NavMeshGenerator3D::baking_use_high_priority_threads, SNAME("NavMeshGeneratorBakeTile3D"));
+		}
+		// Waiting on each task lets an async bake running on a pool thread bake tiles itself meanwhile.
+		for (WorkerThreadPool::TaskID tile_task_id : tile_task_ids) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(tile_task_id);
+		}
+	} else {
+		for (NavMeshGeneratorTile3D &tile : tiles) {
+			generator_thread_bake_tile(&tile);
+		}
+	}
+
+	NavMeshTileStitcher3D stitcher;
+	stitcher.tile_size = tile_size;
+	stitcher.cell_size = p_cfg.cs;
+	stitcher.cell_height = p_cfg.ch;
+
+	LocalVector<int> vertex_map;
+	if (!bake_all_tiles) {
+		// Keep the polygons of the tiles that were not baked again.
+		const Vector<Vector3> previous_vertices = p_navigation_mesh->get_vertices();
+		vertex_map.resize(previous_vertices.size());
+		for (int &vertex : vertex_map) {
+			vertex = -1;
+		}
+		for (int i = 0; i < p_navigation_mesh->get_polygon_count(); i++) {
+			const Vector<int> polygon = p_navigation_mesh->get_polygon(i);
+			Vector3 polygon_center;
+			for (int vertex : polygon) {
+				ERR_CONTINUE(vertex < 0 || vertex >= previous_vertices.size());
+				polygon_center += previous_vertices[vertex];
+			}
+			polygon_center /= MAX(1, polygon.size());
+			if (baked_tiles.has(Vector2i((int)Math::floor(polygon_center.x / tile_size), (int)Math::floor(polygon_center.z / tile_size)))) {
+				continue;
+			}
+			stitcher.add_polygon(previous_vertices, polygon, vertex_map);
+		}
+	}
+
+	for (const NavMeshGeneratorTile3D &tile : tiles) {
+		vertex_map.resize(tile.vertices.size());
+		for (int &vertex : vertex_map) {
+			vertex = -1;
+		}
+		for (const Vector<int> &polygon : tile.polygons) {
+			stitcher.add_polygon(tile.vertices, polygon, vertex_map);
+		}
+	}
+
+	stitcher.split_border_edges();
+
+	p_navigation_mesh->set_vertices(stitcher.vertices);
+	p_navigation_mesh->clear_polygons();
+	for (const Vector<int> &polygon : stitcher.polygons) {
+		p_navigation_mesh->add_polygon(polygon);
+	}
+}
+
+bool NavMeshGenerator3D::generator_bake_polygons(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Vector<int> &p_indices, const rcConfig &p_cfg, Vector<Vector3> &r_vertices, LocalVector<Vector<int>> &r_polygons) {
+	const Vector<float> &vertices = p_source_geometry_data->get_vertices();
+
+	const float *verts = vertices.ptr();
+	const int nverts = vertices.size() / 3;
+	const int *tris = p_indices.ptr();
+	const int ntris = p_indices.size() / 3;
+
+	rcHeightfield *hf = nullptr;
+	rcCompactHeightfield *chf = nullptr;
+	rcContourSet *cset = nullptr;
+	rcPolyMesh *poly_mesh = nullptr;
+	rcPolyMeshDetail *detail_mesh = nullptr;
+	rcContext ctx;
+
+	// added to keep track of steps, no functionality right now
+	String bake_state = "";
+
 	bake_state = "Creating heightfield..."; // step #3
 	hf = rcAllocHeightfield();
 
-	ERR_FAIL_NULL(hf);
-	ERR_FAIL_COND(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch));
+	ERR_FAIL_NULL_V(hf, false);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&ctx, *hf, p_cfg.width, p_cfg.height, p_cfg.bmin, p_cfg.bmax, p_cfg.cs, p_cfg.ch), false);
 
 	bake_state = "Marking walkable triangles..."; // step #4
 	{
 		Vector<unsigned char> tri_areas;
 		tri_areas.resize(ntris);
 
-		ERR_FAIL_COND(tri_areas.is_empty());
+		ERR_FAIL_COND_V(tri_areas.is_empty(), false);
 
 		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
-		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
+		rcMarkWalkableTriangles(&ctx, p_cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
 
-		ERR_FAIL_COND(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb));
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, p_cfg.walkableClimb), false);
 	}
 
 	if (p_navigation_mesh->get_filter_low_hanging_obstacles()) {
-		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *hf);
+		rcFilterLowHangingWalkableObstacles(&ctx, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_ledge_spans()) {
-		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf);
+		rcFilterLedgeSpans(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_walkable_low_height_spans()) {
-		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
+		rcFilterWalkableLowHeightSpans(&ctx, p_cfg.walkableHeight, *hf);
 	}
 
 	bake_state = "Constructing compact heightfield..."; // step #5
 
 	chf = rcAllocCompactHeightfield();
 
-	ERR_FAIL_NULL(chf);
-	ERR_FAIL_COND(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf));
+	ERR_FAIL_NULL_V(chf, false);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf, *chf), false);
 
 	rcFreeHeightField(hf);
 	hf = nullptr;
@@ -839,7 +1197,7 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 
 	bake_state = "Eroding walkable area..."; // step #6
 
-	ERR_FAIL_COND(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf));
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&ctx, p_cfg.walkableRadius, *chf), false);
 
 	// Carve obstacles to the eroded geometry. Those will NOT be affected by e.g. agent_radius because that step is already done.
 	if (!projected_obstructions.is_empty()) {
@@ -861,30 +1219,30 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	bake_state = "Partitioning..."; // step #7
 
 	if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
-		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&ctx, *chf), false);
+		ERR_FAIL_COND_V(!rcBuildRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea));
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea), false);
 	}
 
 	bake_state = "Creating contours..."; // step #8
 
 	cset = rcAllocContourSet();
 
-	ERR_FAIL_NULL(cset);
-	ERR_FAIL_COND(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset));
+	ERR_FAIL_NULL_V(cset, false);
+	ERR_FAIL_COND_V(!rcBuildContours(&ctx, *chf, p_cfg.maxSimplificationError, p_cfg.maxEdgeLen, *cset), false);
 
 	bake_state = "Creating polymesh..."; // step #9
 
 	poly_mesh = rcAllocPolyMesh();
-	ERR_FAIL_NULL(poly_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh));
+	ERR_FAIL_NULL_V(poly_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&ctx, *cset, p_cfg.maxVertsPerPoly, *poly_mesh), false);
 
 	detail_mesh = rcAllocPolyMeshDetail();
-	ERR_FAIL_NULL(detail_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh));
+	ERR_FAIL_NULL_V(detail_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, p_cfg.detailSampleDist, p_cfg.detailSampleMaxError, *detail_mesh), false);
 
 	rcFreeCompactHeightfield(chf);
 	chf = nullptr;
@@ -893,14 +1251,12 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 
 	bake_state = "Converting to native navigation mesh..."; // step #10
 
-	Vector<Vector3> nav_vertices;
-
+	r_vertices.resize(detail_mesh->nverts);
+	Vector3 *r_vertices_ptrw = r_vertices.ptrw();
 	for (int i = 0; i < detail_mesh->nverts; i++) {
 		const float *v = &detail_mesh->verts[i * 3];
-		nav_vertices.push_back(Vector3(v[0], v[1], v[2]));
+		r_vertices_ptrw[i] = Vector3(v[0], v[1], v[2]);
 	}
-	p_navigation_mesh->set_vertices(nav_vertices);
-	p_navigation_mesh->clear_polygons();
 
 	for (int i = 0; i < detail_mesh->nmeshes; i++) {
 		const unsigned int *detail_mesh_m = &detail_mesh->meshes[i * 4];
@@ -915,7 +1271,7 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 			nav_indices.write[0] = ((int)(detail_mesh_bverts + detail_mesh_tris[j * 4 + 0]));
 			nav_indices.write[1] = ((int)(detail_mesh_bverts + detail_mesh_tris[j * 4 + 2]));
 			nav_indices.write[2] = ((int)(detail_mesh_bverts + detail_mesh_tris[j * 4 + 1]));
-			p_navigation_mesh->add_polygon(nav_indices);
+			r_polygons.push_back(nav_indices);
 		}
 	}
 
@@ -926,7 +1282,7 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	rcFreePolyMeshDetail(detail_mesh);
 	detail_mesh = nullptr;
 
-	bake_state = "Baking finished."; // step #12
+	return true;
 }
 
 bool NavMeshGenerator3D::generator_emit_callback(const Callable &p_callback) {
@@ -37,6 +37,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/templates/sort_array.h"
 
 #include <Obstacle2d.h>
 
@@ -54,6 +55,57 @@
 		r_path_owners->push_back(poly->owner->get_owner_id()); \
 	}
 
+static void _print_edge_merge_error() {
+	ERR_PRINT_ONCE("Navigation map synchronization error. Attempted to merge a navigation mesh polygon edge with another already-merged edge. This is usually caused by crossing edges, overlapping polygons, or a mismatch of the NavigationMesh / NavigationPolygon baked 'cell_size' and navigation map 'cell_size'. If you're certain none of above is the case, change 'navigation/3d/merge_rasterizer_cell_scale' to 0.001.");
+}
+
+static void _erase_region_connection(Vector<gd::Edge::Connection> &r_connections, const gd::Edge::Connection &p_connection) {
+	for (int i = 0; i < r_connections.size(); i++) {
+		const gd::Edge::Connection &connection = r_connections[i];
+		if (connection.polygon == p_connection.polygon && connection.edge == p_connection.edge && connection.pathway_start == p_connection.pathway_start && connection.pathway_end == p_connection.pathway_end) {
+			r_connections.remove_at(i);
+			return;
+		}
+	}
+}
+
+// Maximum number of polygons in a leaf of the polygon BVH.
+#define POLYGON_BVH_LEAF_SIZE 4
+// The polygon BVH is split at the median so its depth is logarithmic, this is enough for any polygon count.
+#define POLYGON_BVH_STACK_SIZE 64
+
+struct PolygonBVHCenterComparator {
+	const AABB *aabbs = nullptr;
+	int axis = 0;
+
+	_FORCE_INLINE_ bool operator()(uint32_t p_a, uint32_t p_b) const {
+		return aabbs[p_a].get_center()[axis] < aabbs[p_b].get_center()[axis];
+	}
+};
+
+static _FORCE_INLINE_ real_t _aabb_distance_squared(const AABB &p_a, const AABB &p_b) {
+	real_t distance_squared = 0.0;
+	for (int i = 0; i < 3; i++) {
+		const real_t gap = MAX(p_a.position[i] - (p_b.position[i] + p_b.size[i]), p_b.position[i] - (p_a.position[i] + p_a.size[i]));
+		if (gap > 0.0) {
+			distance_squared += gap * gap;
+		}
+	}
+	return distance_squared;
+}
+
+// Pushes the children of an internal node so that the one closest to the query is visited first.
+template <typename T>
+static _FORCE_INLINE_ void _push_polygon_bvh_children(const LocalVector<T> &p_nodes, const T &p_node, const AABB &p_query_aabb, uint32_t *r_stack, uint32_t &r_stack_size) {
+	if (_aabb_distance_squared(p_nodes[p_node.first].aabb, p_query_aabb) <= _aabb_distance_squared(p_nodes[p_node.first + 1].aabb, p_query_aabb)) {
+		r_stack[r_stack_size++] = p_node.first + 1;
+		r_stack[r_stack_size++] = p_node.first;
+	} else {
+		r_stack[r_stack_size++] = p_node.first;
+		r_stack[r_stack_size++] = p_node.first + 1;
+	}
+}
+
 #ifdef DEBUG_ENABLED
 #define NAVMAP_ITERATION_ZERO_ERROR_MSG() \
 	ERR_PRINT_ONCE("NavigationServer navigation map query failed because it was made before first map synchronization.\n\
@@ -122,6 +174,14 @@ void NavMap::set_link_connection_radius(real_t p_link_connection_radius) {
 	regenerate_links = true;
 }
 
+void NavMap::set_use_hierarchical_pathfinding(bool p_enabled) {
+	if (use_hierarchical_pathfinding == p_enabled) {
+		return;
+	}
+	use_hierarchical_pathfinding = p_enabled;
+	regenerate_links = true;
+}
+
 gd::PointKey NavMap::get_point_key(const Vector3 &p_pos) const {
 	const int x = static_cast<int>(Math::floor(p_pos.x / merge_rasterizer_cell_size));
 	const int y = static_cast<int>(Math::floor(p_pos.y / merge_rasterizer_cell_height));
@@ -135,7 +195,7 @@ gd::PointKey NavMap::get_point_key(const Vector3 &p_pos) const {
 	return p;
 }
 
-Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners) const {
+Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners, int *r_expanded_polygon_count) const {
 	RWLockRead read_lock(map_rwlock);
 	if (iteration_id == 0) {
 		NAVMAP_ITERATION_ZERO_ERROR_MSG();
@@ -152,42 +212,18 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	if (r_path_owners) {
 		r_path_owners->clear();
 	}
+	if (r_expanded_polygon_count) {
+		*r_expanded_polygon_count = 0;
+	}
 
 	// Find the start poly and the end poly on this map.
-	const gd::Polygon *begin_poly = nullptr;
-	const gd::Polygon *end_poly = nullptr;
 	Vector3 begin_point;
 	Vector3 end_point;
-	real_t begin_d = FLT_MAX;
 	real_t end_d = FLT_MAX;
-	// Find the initial poly and the end poly on this map.
-	for (const gd::Polygon &p : polygons) {
-		// Only consider the polygon if it in a region with compatible layers.
-		if ((p_navigation_layers & p.owner->get_navigation_layers()) == 0) {
-			continue;
-		}
-
-		// For each face check the distance between the origin/destination
-		for (size_t point_id = 2; point_id < p.points.size(); point_id++) {
-			const Face3 face(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-
-			Vector3 point = face.get_closest_point_to(p_origin);
-			real_t distance_to_point = point.distance_to(p_origin);
-			if (distance_to_point < begin_d) {
-				begin_d = distance_to_point;
-				begin_poly = &p;
-				begin_point = point;
-			}
-
-			point = face.get_closest_point_to(p_destination);
-			distance_to_point = point.distance_to(p_destination);
-			if (distance_to_point < end_d) {
-				end_d = distance_to_point;
-				end_poly = &p;
-				end_point = point;
-			}
-		}
-	}
+	const int64_t begin_poly_index = _get_closest_polygon_index(p_origin, FLT_MAX, true, p_navigation_layers, begin_point);
+	const int64_t end_poly_index = _get_closest_polygon_index(p_destination, FLT_MAX, true, p_navigation_layers, end_point);
+	const gd::Polygon *begin_poly = begin_poly_index != -1 ? polygons[begin_poly_index] : nullptr;
+	const gd::Polygon *end_poly = end_poly_index != -1 ? polygons[end_poly_index] : nullptr;
 
 	// Check for trivial cases
 	if (!begin_poly || !end_poly) {
@@ -219,6 +255,11 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		return path;
 	}
 
+	// With hierarchical pathfinding, only search the polygons of the regions and links along the route found on the region graph.
+	// A map with a single region has no graph, the whole map is searched then.
+	HashSet<const NavBase *> route_owners;
+	bool use_route = use_hierarchical_pathfinding && !region_graph.is_empty() && begin_poly->owner != end_poly->owner && _get_region_route(begin_poly->owner, end_poly->owner, p_navigation_layers, route_owners);
+
 	// List of all reachable navigation polys.
 	LocalVector<gd::NavigationPoly> navigation_polys;
 	navigation_polys.reserve(polygons.size() * 0.75);
@@ -243,8 +284,11 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	const gd::Polygon *reachable_end = nullptr;
 	real_t reachable_d = FLT_MAX;
 	bool is_reachable = true;
+	int expanded_polygon_count = 0;
 
 	while (true) {
+		expanded_polygon_count++;
+
 		// Takes the current least_cost_poly neighbors (iterating over its edges) and compute the traveled_distance.
 		for (const gd::Edge &edge : navigation_polys[least_cost_id].poly->edges) {
 			// Iterate over connections in this edge, then compute the new optimized travel distance assigned to this polygon.
@@ -256,6 +300,11 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 					continue;
 				}
 
+				// Stay on the region route if there is one.
+				if (use_route && !route_owners.has(connection.polygon->owner)) {
+					continue;
+				}
+
 				const gd::NavigationPoly &least_cost_poly = navigation_polys[least_cost_id];
 				real_t poly_enter_cost = 0.0;
 				real_t poly_travel_cost = least_cost_poly.poly->owner->get_travel_cost();
@@ -303,6 +352,24 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		// Removes the least cost polygon from the list of polygons to visit so we can advance.
 		to_visit.erase(least_cost_id);
 
+		// The region route is not connected at the polygon level, search the whole map instead.
+		if (to_visit.size() == 0 && use_route) {
+			use_route = false;
+
+			gd::NavigationPoly np = navigation_polys[0];
+			navigation_polys.clear();
+			navigation_polys.push_back(np);
+			to_visit.clear();
+			to_visit.push_back(0);
+			least_cost_id = 0;
+			prev_least_cost_id = -1;
+
+			reachable_end = nullptr;
+			reachable_d = FLT_MAX;
+
+			continue;
+		}
+
 		// When the list of polygons to visit is empty at this point it means the End Polygon is not reachable
 		if (to_visit.size() == 0) {
 			// Thus use the further reachable polygon
@@ -340,6 +407,10 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 			}
 
 			if (closest_point_on_start_poly) {
+				if (r_expanded_polygon_count) {
+					*r_expanded_polygon_count = expanded_polygon_count;
+				}
+
 				// No point to run PostProcessing when start and end convex polygon is the same.
 				if (r_path_types) {
 					r_path_types->resize(2);
@@ -411,6 +482,10 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		}
 	}
 
+	if (r_expanded_polygon_count) {
+		*r_expanded_polygon_count = expanded_polygon_count;
+	}
+
 	// We did not find a route but we have both a start polygon and an end polygon at this point.
 	// Usually this happens because there was not a single external or internal connected edge, e.g. our start polygon is an isolated, single convex polygon.
 	if (!found_route) {
@@ -607,29 +682,75 @@ Vector3 NavMap::get_closest_point_to_segment(const Vector3 &p_from, const Vector
 		return Vector3();
 	}
 
-	bool use_collision = p_use_collision;
 	Vector3 closest_point;
 	real_t closest_point_d = FLT_MAX;
+	int64_t closest_polygon_index = -1;
 
-	for (const gd::Polygon &p : polygons) {
-		// For each face check the distance to the segment
-		for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
-			const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-			Vector3 inters;
-			if (f.intersects_segment(p_from, p_to, &inters)) {
-				const real_t d = closest_point_d = p_from.distance_to(inters);
-				if (use_collision == false) {
-					closest_point = inters;
-					use_collision = true;
-					closest_point_d = d;
-				} else if (closest_point_d > d) {
-					closest_point = inters;
-					closest_point_d = d;
+	if (polygon_bvh_nodes.is_empty()) {
+		return closest_point;
+	}
+
+	uint32_t stack[POLYGON_BVH_STACK_SIZE];
+	uint32_t stack_size = 0;
+
+	// Find the intersection of the segment with the polygon faces that is closest to its start.
+	stack[stack_size++] = 0;
+	while (stack_size > 0) {
+		const PolygonBVHNode &node = polygon_bvh_nodes[stack[--stack_size]];
+		if (!node.aabb.intersects_segment(p_from, p_to)) {
+			continue;
+		}
+
+		if (node.count == 0) {
+			stack[stack_size++] = node.first + 1;
+			stack[stack_size++] = node.first;
+			continue;
+		}
+
+		for (uint32_t i = node.first; i < node.first + node.count; i++) {
+			const uint32_t polygon_index = polygon_bvh_indices[i];
+			const gd::Polygon &p = *polygons[polygon_index];
+
+			// For each face check the distance to the segment
+			for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
+				const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
+				Vector3 inters;
+				if (f.intersects_segment(p_from, p_to, &inters)) {
+					const real_t d = p_from.distance_to(inters);
+					if (d < closest_point_d || (d == closest_point_d && polygon_index < closest_polygon_index)) {
+						closest_point = inters;
+						closest_point_d = d;
+						closest_polygon_index = polygon_index;
+					}
 				}
 			}
 		}
+	}
+
+	if (closest_polygon_index != -1 || p_use_collision) {
+		return closest_point;
+	}
+
+	// The segment does not touch the navigation mesh, use the point on the polygon edges closest to it instead.
+	AABB segment_aabb(p_from, Vector3());
+	segment_aabb.expand_to(p_to);
+
+	stack[stack_size++] = 0;
+	while (stack_size > 0) {
+		const PolygonBVHNode &node = polygon_bvh_nodes[stack[--stack_size]];
+		if (_aabb_distance_squared(node.aabb, segment_aabb) > closest_point_d) {
+			continue;
+		}
+
+		if (node.count == 0) {
+			_push_polygon_bvh_children(polygon_bvh_nodes, node, segment_aabb, stack, stack_size);
+			continue;
+		}
+
+		for (uint32_t i = node.first; i < node.first + node.count; i++) {
+			const uint32_t polygon_index = polygon_bvh_indices[i];
+			const gd::Polygon &p = *polygons[polygon_index];
 
-		if (use_collision == false) {
 			for (size_t point_id = 0; point_id < p.points.size(); point_id += 1) {
 				Vector3 a, b;
 
@@ -641,10 +762,11 @@ Vector3 NavMap::get_closest_point_to_segment(const Vector3 &p_from, const Vector
 						a,
 						b);
 
-				const real_t d = a.distance_to(b);
-				if (d < closest_point_d) {
-					closest_point_d = d;
+				const real_t ds = a.distance_squared_to(b);
+				if (ds < closest_point_d || (ds == closest_point_d && polygon_index < closest_polygon_index)) {
+					closest_point_d = ds;
 					closest_point = b;
+					closest_polygon_index = polygon_index;
 				}
 			}
 		}
@@ -687,21 +809,10 @@ gd::ClosestPointQueryResult NavMap::get_closest_point_info(const Vector3 &p_poin
 	RWLockRead read_lock(map_rwlock);
 
 	gd::ClosestPointQueryResult result;
-	real_t closest_point_ds = FLT_MAX;
-
-	for (const gd::Polygon &p : polygons) {
-		// For each face check the distance to the point
-		for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
-			const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-			const Vector3 inters = f.get_closest_point_to(p_point);
-			const real_t ds = inters.distance_squared_to(p_point);
-			if (ds < closest_point_ds) {
-				result.point = inters;
-				result.normal = f.get_plane().normal;
-				result.owner = p.owner->get_self();
-				closest_point_ds = ds;
-			}
-		}
+
+	const int64_t closest_polygon_index = _get_closest_polygon_index(p_point, FLT_MAX, false, 0, result.point, &result.normal);
+	if (closest_polygon_index != -1) {
+		result.owner = polygons[closest_polygon_index]->owner->get_self();
 	}
 
 	return result;
@@ -709,27 +820,26 @@ gd::ClosestPointQueryResult NavMap::get_closest_point_info(const Vector3 &p_poin
 
 void NavMap::add_region(NavRegion *p_region) {
 	regions.push_back(p_region);
-	regenerate_links = true;
 }
 
 void NavMap::remove_region(NavRegion *p_region) {
 	int64_t region_index = regions.find(p_region);
 	if (region_index >= 0) {
 		regions.remove_at_unordered(region_index);
-		regenerate_links = true;
+		removed_regions.push_back(p_region);
 	}
 }
 
 void NavMap::add_link(NavLink *p_link) {
 	links.push_back(p_link);
-	regenerate_links = true;
+	links_dirty = true;
 }
 
 void NavMap::remove_link(NavLink *p_link) {
 	int64_t link_index = links.find(p_link);
 	if (link_index >= 0) {
 		links.remove_at_unordered(link_index);
-		regenerate_links = true;
+		links_dirty = true;
 	}
 }
 
@@ -900,99 +1010,159 @@ void NavMap::sync() {
 		regenerate_links = true;
 	}
 
+	// Only the regions that changed since the last sync are reconnected, unless a map setting changed.
+	LocalVector<NavRegion *> changed_regions;
 	for (NavRegion *region : regions) {
-		if (region->sync()) {
-			regenerate_links = true;
+		if (region->sync() || regenerate_links) {
+			changed_regions.push_back(region);
 		}
 	}
 
 	for (NavLink *link : links) {
 		if (link->check_dirty()) {
-			regenerate_links = true;
+			links_dirty = true;
 		}
 	}
 
-	if (regenerate_links) {
+	if (regenerate_links || links_dirty || !changed_regions.is_empty() || !removed_regions.is_empty()) {
 		_new_pm_polygon_count = 0;
 		_new_pm_edge_count = 0;
 		_new_pm_edge_merge_count = 0;
 		_new_pm_edge_connection_count = 0;
 		_new_pm_edge_free_count = 0;
 
-		// Remove regions connections.
-		for (NavRegion *region : regions) {
-			region->get_connections().clear();
+		// Remove the link entries, all links are connected again after the regions.
+		for (gd::Polygon *polygon : link_connected_polygons) {
+			Vector<gd::Edge::Connection> &connections = polygon->edges[0].connections;
+			for (int i = connections.size() - 1; i >= 0; i--) {
+				if (connections[i].edge == -1) {
+					connections.remove_at(i);
+				}
+			}
 		}
+		link_connected_polygons.clear();
 
-		// Resize the polygon count.
-		int count = 0;
-		for (const NavRegion *region : regions) {
+		// Border edge keys whose connections need to be updated.
+		HashSet<gd::EdgeKey, gd::EdgeKey> changed_edge_keys;
+
+		if (regenerate_links) {
+			region_polygons.clear();
+			border_edges.clear();
+			for (NavRegion *region : regions) {
+				region->get_connections().clear();
+			}
+		} else {
+			// Disconnect the polygons of the removed and changed regions from the rest of the map.
+			HashSet<const NavBase *> disconnected_owners;
+			for (const NavRegion *region : removed_regions) {
+				disconnected_owners.insert(region);
+			}
+			for (const NavRegion *region : changed_regions) {
+				disconnected_owners.insert(region);
+			}
+			_purge_owner_connections(disconnected_owners);
+			for (const NavBase *owner : disconnected_owners) {
+				HashMap<const NavRegion *, RegionPolygons>::Iterator E = region_polygons.find(static_cast<const NavRegion *>(owner));
+				if (E) {
+					_disconnect_region_polygons(E->value.polygons, changed_edge_keys);
+				}
+			}
+			for (const NavRegion *region : removed_regions) {
+				region_polygons.erase(region);
+			}
+			for (NavRegion *region : changed_regions) {
+				region->get_connections().clear();
+			}
+		}
+		removed_regions.clear();
+
+		// Copy the polygons of the changed regions in the map.
+		HashSet<const NavBase *> changed_owners;
+		for (const NavRegion *region : changed_regions) {
+			changed_owners.insert(region);
 			if (!region->get_enabled()) {
+				region_polygons.erase(region);
 				continue;
 			}
-			count += region->get_polygons().size();
+			RegionPolygons &changed_region_polygons = region_polygons[region];
+			changed_region_polygons.polygons = region->get_polygons();
+			changed_region_polygons.internal_edge_count = 0;
 		}
-		polygons.resize(count);
 
-		// Copy all region polygons in the map.
-		count = 0;
+		// Gather the polygons of all enabled regions, in the regions order.
+		polygons.clear();
 		for (const NavRegion *region : regions) {
-			if (!region->get_enabled()) {
+			HashMap<const NavRegion *, RegionPolygons>::Iterator E = region_polygons.find(region);
+			if (!E) {
 				continue;
 			}
-			const LocalVector<gd::Polygon> &polygons_source = region->get_polygons();
-			for (uint32_t n = 0; n < polygons_source.size(); n++) {
-				polygons[count + n] = polygons_source[n];
+			for (gd::Polygon &polygon : E->value.polygons) {
+				polygons.push_back(&polygon);
 			}
-			count += region->get_polygons().size();
 		}
 
 		_new_pm_polygon_count = polygons.size();
 
-		// Group all edges per key.
-		HashMap<gd::EdgeKey, Vector<gd::Edge::Connection>, gd::EdgeKey> connections;
-		for (gd::Polygon &poly : polygons) {
-			for (uint32_t p = 0; p < poly.points.size(); p++) {
-				int next_point = (p + 1) % poly.points.size();
-				gd::EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
-
-				HashMap<gd::EdgeKey, Vector<gd::Edge::Connection>, gd::EdgeKey>::Iterator connection = connections.find(ek);
-				if (!connection) {
-					connections[ek] = Vector<gd::Edge::Connection>();
-					_new_pm_edge_count += 1;
-				}
-				if (connections[ek].size() <= 1) {
-					// Add the polygon/edge tuple to this key.
-					gd::Edge::Connection new_connection;
-					new_connection.polygon = &poly;
-					new_connection.edge = p;
-					new_connection.pathway_start = poly.points[p].pos;
-					new_connection.pathway_end = poly.points[next_point].pos;
-					connections[ek].push_back(new_connection);
-				} else {
-					// The edge is already connected with another edge, skip.
-					ERR_PRINT_ONCE("Navigation map synchronization error. Attempted to merge a navigation mesh polygon edge with another already-merged edge. This is usually caused by crossing edges, overlapping polygons, or a mismatch of the NavigationMesh / NavigationPolygon baked 'cell_size' and navigation map 'cell_size'. If you're certain none of above is the case, change 'navigation/3d/merge_rasterizer_cell_scale' to 0.001.");
+		_build_polygon_bvh();
+
+		for (const NavRegion *region : changed_regions) {
+			HashMap<const NavRegion *, RegionPolygons>::Iterator E = region_polygons.find(region);
+			if (E) {
+				_connect_region_polygons(E->value, changed_edge_keys);
+			}
+		}
+
+		// Edges of the unchanged regions are connected again with the new edges of their key.
+		HashSet<Pair<const gd::Polygon *, int>, PairHash<const gd::Polygon *, int>> cleared_edges;
+		for (const gd::EdgeKey &edge_key : changed_edge_keys) {
+			HashMap<gd::EdgeKey, LocalVector<gd::Edge::Connection>, gd::EdgeKey>::Iterator E = border_edges.find(edge_key);
+			if (!E) {
+				continue;
+			}
+			for (const gd::Edge::Connection &edge : E->value) {
+				if (!changed_owners.has(edge.polygon->owner)) {
+					_clear_edge_connections(*edge.polygon, edge.edge);
+					cleared_edges.insert(Pair<const gd::Polygon *, int>(edge.polygon, edge.edge));
 				}
 			}
 		}
+		_purge_edge_connections(cleared_edges);
 
-		Vector<gd::Edge::Connection> free_edges;
-		for (KeyValue<gd::EdgeKey, Vector<gd::Edge::Connection>> &E : connections) {
-			if (E.value.size() == 2) {
-				// Connect edge that are shared in different polygons.
-				gd::Edge::Connection &c1 = E.value.write[0];
-				gd::Edge::Connection &c2 = E.value.write[1];
+		// Connect the changed border edges that are shared between regions, the others are free edges.
+		LocalVector<gd::Edge::Connection> changed_free_edges;
+		for (const gd::EdgeKey &edge_key : changed_edge_keys) {
+			HashMap<gd::EdgeKey, LocalVector<gd::Edge::Connection>, gd::EdgeKey>::Iterator E = border_edges.find(edge_key);
+			if (!E) {
+				continue;
+			}
+			const LocalVector<gd::Edge::Connection> &edges = E->value;
+
+			if (edges.size() == 2) {
+				const gd::Edge::Connection &c1 = edges[0];
+				const gd::Edge::Connection &c2 = edges[1];
 				c1.polygon->edges[c1.edge].connections.push_back(c2);
 				c2.polygon->edges[c2.edge].connections.push_back(c1);
 				// Note: The pathway_start/end are full for those connection and do not need to be modified.
+			} else if (use_edge_connections && edges[0].polygon->owner->get_use_edge_connections()) {
+				changed_free_edges.push_back(edges[0]);
+			}
+		}
+
+		LocalVector<gd::Edge::Connection> free_edges;
+		LocalVector<bool> free_edges_changed;
+		for (const KeyValue<gd::EdgeKey, LocalVector<gd::Edge::Connection>> &E : border_edges) {
+			_new_pm_edge_count += 1;
+			if (E.value.size() == 2) {
 				_new_pm_edge_merge_count += 1;
-			} else {
-				CRASH_COND_MSG(E.value.size() != 1, vformat("Number of connection != 1. Found: %d", E.value.size()));
-				if (use_edge_connections && E.value[0].polygon->owner->get_use_edge_connections()) {
-					free_edges.push_back(E.value[0]);
-				}
+			} else if (use_edge_connections && E.value[0].polygon->owner->get_use_edge_connections()) {
+				free_edges.push_back(E.value[0]);
+				free_edges_changed.push_back(changed_edge_keys.has(E.key));
 			}
 		}
+		for (const KeyValue<const NavRegion *, RegionPolygons> &E : region_polygons) {
+			_new_pm_edge_count += E.value.internal_edge_count;
+			_new_pm_edge_merge_count += E.value.internal_edge_count;
+		}
 
 		// Find the compatible near edges.
 		//
@@ -1003,63 +1173,24 @@ void NavMap::sync() {
 		// connection, integration and path finding.
 		_new_pm_edge_free_count = free_edges.size();
 
-		for (int i = 0; i < free_edges.size(); i++) {
-			const gd::Edge::Connection &free_edge = free_edges[i];
-			Vector3 edge_p1 = free_edge.polygon->points[free_edge.edge].pos;
-			Vector3 edge_p2 = free_edge.polygon->points[(free_edge.edge + 1) % free_edge.polygon->points.size()].pos;
-
-			for (int j = 0; j < free_edges.size(); j++) {
-				const gd::Edge::Connection &other_edge = free_edges[j];
-				if (i == j || free_edge.polygon->owner == other_edge.polygon->owner) {
-					continue;
-				}
-
-				Vector3 other_edge_p1 = other_edge.polygon->points[other_edge.edge].pos;
-				Vector3 other_edge_p2 = other_edge.polygon->points[(other_edge.edge + 1) % other_edge.polygon->points.size()].pos;
-
-				// Compute the projection of the opposite edge on the current one
-				Vector3 edge_vector = edge_p2 - edge_p1;
-				real_t projected_p1_ratio = edge_vector.dot(other_edge_p1 - edge_p1) / (edge_vector.length_squared());
-				real_t projected_p2_ratio = edge_vector.dot(other_edge_p2 - edge_p1) / (edge_vector.length_squared());
-				if ((projected_p1_ratio < 0.0 && projected_p2_ratio < 0.0) || (projected_p1_ratio > 1.0 && projected_p2_ratio > 1.0)) {
-					continue;
-				}
-
-				// Check if the two edges are close to each other enough and compute a pathway between the two regions.
-				Vector3 self1 = edge_vector * CLAMP(projected_p1_ratio, 0.0, 1.0) + edge_p1;
-				Vector3 other1;
-				if (projected_p1_ratio >= 0.0 && projected_p1_ratio <= 1.0) {
-					other1 = other_edge_p1;
-				} else {
-					other1 = other_edge_p1.lerp(other_edge_p2, (1.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
-				}
-				if (other1.distance_to(self1) > edge_connection_margin) {
+		for (const gd::Edge::Connection &changed_free_edge : changed_free_edges) {
+			for (uint32_t i = 0; i < free_edges.size(); i++) {
+				const gd::Edge::Connection &free_edge = free_edges[i];
+				if (changed_free_edge.polygon->owner == free_edge.polygon->owner) {
 					continue;
 				}
-
-				Vector3 self2 = edge_vector * CLAMP(projected_p2_ratio, 0.0, 1.0) + edge_p1;
-				Vector3 other2;
-				if (projected_p2_ratio >= 0.0 && projected_p2_ratio <= 1.0) {
-					other2 = other_edge_p2;
-				} else {
-					other2 = other_edge_p1.lerp(other_edge_p2, (0.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+				_connect_free_edge(changed_free_edge, free_edge);
+				// Changed free edges connect to the others themselves.
+				if (!free_edges_changed[i]) {
+					_connect_free_edge(free_edge, changed_free_edge);
 				}
-				if (other2.distance_to(self2) > edge_connection_margin) {
-					continue;
-				}
-
-				// The edges can now be connected.
-				gd::Edge::Connection new_connection = other_edge;
-				new_connection.pathway_start = (self1 + other1) / 2.0;
-				new_connection.pathway_end = (self2 + other2) / 2.0;
-				free_edge.polygon->edges[free_edge.edge].connections.push_back(new_connection);
-
-				// Add the connection to the region_connection map.
-				((NavRegion *)free_edge.polygon->owner)->get_connections().push_back(new_connection);
-				_new_pm_edge_connection_count += 1;
 			}
 		}
 
+		for (NavRegion *region : regions) {
+			_new_pm_edge_connection_count += region->get_connections().size();
+		}
+
 		uint32_t link_poly_idx = 0;
 		link_polygons.resize(links.size());
 
@@ -1071,49 +1202,14 @@ void NavMap::sync() {
 			const Vector3 start = link->get_start_position();
 			const Vector3 end = link->get_end_position();
 
-			gd::Polygon *closest_start_polygon = nullptr;
-			real_t closest_start_distance = link_connection_radius;
+			// Find the closest polygons within the search radius of the start and end points.
 			Vector3 closest_start_point;
+			const int64_t closest_start_index = _get_closest_polygon_index(start, link_connection_radius, false, 0, closest_start_point);
+			gd::Polygon *closest_start_polygon = closest_start_index != -1 ? polygons[closest_start_index] : nullptr;
 
-			gd::Polygon *closest_end_polygon = nullptr;
-			real_t closest_end_distance = link_connection_radius;
 			Vector3 closest_end_point;
-
-			// Create link to any polygons within the search radius of the start point.
-			for (uint32_t start_index = 0; start_index < polygons.size(); start_index++) {
-				gd::Polygon &start_poly = polygons[start_index];
-
-				// For each face check the distance to the start
-				for (uint32_t start_point_id = 2; start_point_id < start_poly.points.size(); start_point_id += 1) {
-					const Face3 start_face(start_poly.points[0].pos, start_poly.points[start_point_id - 1].pos, start_poly.points[start_point_id].pos);
-					const Vector3 start_point = start_face.get_closest_point_to(start);
-					const real_t start_distance = start_point.distance_to(start);
-
-					// Pick the polygon that is within our radius and is closer than anything we've seen yet.
-					if (start_distance <= link_connection_radius && start_distance < closest_start_distance) {
-						closest_start_distance = start_distance;
-						closest_start_point = start_point;
-						closest_start_polygon = &start_poly;
-					}
-				}
-			}
-
-			// Find any polygons within the search radius of the end point.
-			for (gd::Polygon &end_poly : polygons) {
-				// For each face check the distance to the end
-				for (uint32_t end_point_id = 2; end_point_id < end_poly.points.size(); end_point_id += 1) {
-					const Face3 end_face(end_poly.points[0].pos, end_poly.points[end_point_id - 1].pos, end_poly.points[end_point_id].pos);
-					const Vector3 end_point = end_face.get_closest_point_to(end);
-					const real_t end_distance = end_point.distance_to(end);
-
-					// Pick the polygon that is within our radius and is closer than anything we've seen yet.
-					if (end_distance <= link_connection_radius && end_distance < closest_end_distance) {
-						closest_end_distance = end_distance;
-						closest_end_point = end_point;
-						closest_end_polygon = &end_poly;
-					}
-				}
-			}
+			const int64_t closest_end_index = _get_closest_polygon_index(end, link_connection_radius, false, 0, closest_end_point);
+			gd::Polygon *closest_end_polygon = closest_end_index != -1 ? polygons[closest_end_index] : nullptr;
 
 			// If we have both a start and end point, then create a synthetic polygon to route through.
 			if (closest_start_polygon && closest_end_polygon) {
@@ -1146,6 +1242,7 @@ void NavMap::sync() {
 					entry_connection.pathway_start = new_polygon.points[0].pos;
 					entry_connection.pathway_end = new_polygon.points[1].pos;
 					closest_start_polygon->edges[0].connections.push_back(entry_connection);
+					link_connected_polygons.push_back(closest_start_polygon);
 
 					gd::Edge::Connection exit_connection;
 					exit_connection.polygon = closest_end_polygon;
@@ -1163,6 +1260,7 @@ void NavMap::sync() {
 					entry_connection.pathway_start = new_polygon.points[2].pos;
 					entry_connection.pathway_end = new_polygon.points[3].pos;
 					closest_end_polygon->edges[0].connections.push_back(entry_connection);
+					link_connected_polygons.push_back(closest_end_polygon);
 
 					gd::Edge::Connection exit_connection;
 					exit_connection.polygon = closest_start_polygon;
@@ -1174,6 +1272,13 @@ void NavMap::sync() {
 			}
 		}
 
+		if (use_hierarchical_pathfinding && regions.size() > 1) {
+			_build_region_graph(link_poly_idx);
+		} else {
+			region_graph.clear();
+			region_graph_indices.clear();
+		}
+
 		// Some code treats 0 as a failure case, so we avoid returning 0 and modulo wrap UINT32_MAX manually.
 		iteration_id = iteration_id % UINT32_MAX + 1;
 	}
@@ -1198,6 +1303,7 @@ void NavMap::sync() {
 
 	regenerate_polygons = false;
 	regenerate_links = false;
+	links_dirty = false;
 	obstacles_dirty = false;
 	agents_dirty = false;
 
@@ -1412,6 +1518,402 @@ void NavMap::clip_path(const LocalVector<gd::NavigationPoly> &p_navigation_polys
 	}
 }
 
+void NavMap::_purge_owner_connections(const HashSet<const NavBase *> &p_owners) {
+	// Connections to near edges are not always mutual, so a remaining polygon can point to a
+	// disconnected one without being pointed back. Every border edge is checked instead of
+	// following the connections of the disconnected polygons.
+	for (const KeyValue<gd::EdgeKey, LocalVector<gd::Edge::Connection>> &E : border_edges) {
+		for (const gd::Edge::Connection &edge : E.value) {
+			if (p_owners.has(edge.polygon->owner)) {
+				continue;
+			}
+			Vector<gd::Edge::Connection> &connections = edge.polygon->edges[edge.edge].connections;
+			for (int i = connections.size() - 1; i >= 0; i--) {
+				if (p_owners.has(connections[i].polygon->owner)) {
+					_erase_region_connection(((NavRegion *)edge.polygon->owner)->get_connections(), connections[i]);
+					connections.remove_at(i);
+				}
+			}
+		}
+	}
+}
+
+void NavMap::_disconnect_region_polygons(LocalVector<gd::Polygon> &r_polygons, HashSet<gd::EdgeKey, gd::EdgeKey> &r_changed_edge_keys) {
+	for (gd::Polygon &polygon : r_polygons) {
+		for (uint32_t p = 0; p < polygon.edges.size(); p++) {
+			const gd::EdgeKey edge_key(polygon.points[p].key, polygon.points[(p + 1) % polygon.points.size()].key);
+			HashMap<gd::EdgeKey, LocalVector<gd::Edge::Connection>, gd::EdgeKey>::Iterator E = border_edges.find(edge_key);
+			if (!E) {
+				continue;
+			}
+			LocalVector<gd::Edge::Connection> &edges = E->value;
+			for (uint32_t i = 0; i < edges.size(); i++) {
+				if (edges[i].polygon == &polygon && edges[i].edge == int(p)) {
+					edges.remove_at(i);
+					if (edges.is_empty()) {
+						border_edges.erase(edge_key);
+					} else {
+						r_changed_edge_keys.insert(edge_key);
+					}
+					break;
+				}
+			}
+		}
+	}
+}
+
+void NavMap::_connect_region_polygons(RegionPolygons &r_region_polygons, HashSet<gd::EdgeKey, gd::EdgeKey> &r_changed_edge_keys) {
+	// Group all edges per key.
+	HashMap<gd::EdgeKey, LocalVector<gd::Edge::Connection>, gd::EdgeKey> connections;
+	for (gd::Polygon &poly : r_region_polygons.polygons) {
+		for (uint32_t p = 0; p < poly.points.size(); p++) {
+			int next_point = (p + 1) % poly.points.size();
+			gd::EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
+
+			LocalVector<gd::Edge::Connection> &edge_connections = connections[ek];
+			if (edge_connections.size() <= 1) {
+				// Add the polygon/edge tuple to this key.
+				gd::Edge::Connection new_connection;
+				new_connection.polygon = &poly;
+				new_connection.edge = p;
+				new_connection.pathway_start = poly.points[p].pos;
+				new_connection.pathway_end = poly.points[next_point].pos;
+				edge_connections.push_back(new_connection);
+			} else {
+				// The edge is already connected with another edge, skip.
+				_print_edge_merge_error();
+			}
+		}
+	}
+
+	r_region_polygons.internal_edge_count = 0;
+	for (const KeyValue<gd::EdgeKey, LocalVector<gd::Edge::Connection>> &E : connections) {
+		if (E.value.size() == 2) {
+			// Connect edge that are shared in different polygons.
+			const gd::Edge::Connection &c1 = E.value[0];
+			const gd::Edge::Connection &c2 = E.value[1];
+			c1.polygon->edges[c1.edge].connections.push_back(c2);
+			c2.polygon->edges[c2.edge].connections.push_back(c1);
+			r_region_polygons.internal_edge_count += 1;
+			continue;
+		}
+
+		// The edge is on the border of the region, it is connected with the other regions edges afterwards.
+		LocalVector<gd::Edge::Connection> &edges = border_edges[E.key];
+		if (edges.size() <= 1) {
+			edges.push_back(E.value[0]);
+			r_changed_edge_keys.insert(E.key);
+		} else {
+			_print_edge_merge_error();
+		}
+	}
+}
+
+void NavMap::_clear_edge_connections(gd::Polygon &r_polygon, int p_edge) {
+	Vector<gd::Edge::Connection> &connections = r_polygon.edges[p_edge].connections;
+	Vector<gd::Edge::Connection> &region_connections = ((NavRegion *)r_polygon.owner)->get_connections();
+	for (const gd::Edge::Connection &connection : connections) {
+		_erase_region_connection(region_connections, connection);
+	}
+	connections.clear();
+}
+
+void NavMap::_purge_edge_connections(const HashSet<Pair<const gd::Polygon *, int>, PairHash<const gd::Polygon *, int>> &p_edges) {
+	if (p_edges.is_empty()) {
+		return;
+	}
+	// Same as `_purge_owner_connections()`, for the connections to single edges.
+	for (const KeyValue<gd::EdgeKey, LocalVector<gd::Edge::Connection>> &E : border_edges) {
+		for (const gd::Edge::Connection &edge : E.value) {
+			Vector<gd::Edge::Connection> &connections = edge.polygon->edges[edge.edge].connections;
+			for (int i = connections.size() - 1; i >= 0; i--) {
+				if (p_edges.has(Pair<const gd::Polygon *, int>(connections[i].polygon, connections[i].edge))) {
+					_erase_region_connection(((NavRegion *)edge.polygon->owner)->get_connections(), connections[i]);
+					connections.remove_at(i);
+				}
+			}
+		}
+	}
+}
+
+void NavMap::_connect_free_edge(const gd::Edge::Connection &p_free_edge, const gd::Edge::Connection &p_other_edge) {
+	Vector3 edge_p1 = p_free_edge.polygon->points[p_free_edge.edge].pos;
+	Vector3 edge_p2 = p_free_edge.polygon->points[(p_free_edge.edge + 1) % p_free_edge.polygon->points.size()].pos;
+
+	Vector3 other_edge_p1 = p_other_edge.polygon->points[p_other_edge.edge].pos;
+	Vector3 other_edge_p2 = p_other_edge.polygon->points[(p_other_edge.edge + 1) % p_other_edge.polygon->points.size()].pos;
+
+	// Compute the projection of the opposite edge on the current one
+	Vector3 edge_vector = edge_p2 - edge_p1;
+	real_t projected_p1_ratio = edge_vector.dot(other_edge_p1 - edge_p1) / (edge_vector.length_squared());
+	real_t projected_p2_ratio = edge_vector.dot(other_edge_p2 - edge_p1) / (edge_vector.length_squared());
+	if ((projected_p1_ratio < 0.0 && projected_p2_ratio < 0.0) || (projected_p1_ratio > 1.0 && projected_p2_ratio > 1.0)) {
+		return;
+	}
+
+	// Check if the two edges are close to each other enough and compute a pathway between the two regions.
+	Vector3 self1 = edge_vector * CLAMP(projected_p1_ratio, 0.0, 1.0) + edge_p1;
+	Vector3 other1;
+	if (projected_p1_ratio >= 0.0 && projected_p1_ratio <= 1.0) {
+		other1 = other_edge_p1;
+	} else {
+		other1 = other_edge_p1.lerp(other_edge_p2, (1.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+	}
+	if (other1.distance_to(self1) > edge_connection_margin) {
+		return;
+	}
+
+	Vector3 self2 = edge_vector * CLAMP(projected_p2_ratio, 0.0, 1.0) + edge_p1;
+	Vector3 other2;
+	if (projected_p2_ratio >= 0.0 && projected_p2_ratio <= 1.0) {
+		other2 = other_edge_p2;
+	} else {
+		other2 = other_edge_p1.lerp(other_edge_p2, (0.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+	}
+	if (other2.distance_to(self2) > edge_connection_margin) {
+		return;
+	}
+
+	// The edges can now be connected.
+	gd::Edge::Connection new_connection = p_other_edge;
+	new_connection.pathway_start = (self1 + other1) / 2.0;
+	new_connection.pathway_end = (self2 + other2) / 2.0;
+	p_free_edge.polygon->edges[p_free_edge.edge].connections.push_back(new_connection);
+
+	// Add the connection to the region_connection map.
+	((NavRegion *)p_free_edge.polygon->owner)->get_connections().push_back(new_connection);
+}
+
+void NavMap::_build_polygon_bvh() {
+	polygon_bvh_nodes.clear();
+	polygon_bvh_indices.resize(polygons.size());
+
+	if (polygons.is_empty()) {
+		return;
+	}
+
+	LocalVector<AABB> polygon_aabbs;
+	polygon_aabbs.resize(polygons.size());
+	for (uint32_t i = 0; i < polygons.size(); i++) {
+		const gd::Polygon &p = *polygons[i];
+		AABB aabb(p.points.is_empty() ? p.center : p.points[0].pos, Vector3());
+		for (const gd::Point &point : p.points) {
+			aabb.expand_to(point.pos);
+		}
+		// Grow a bit so flat polygons are not missed by the segment tests due to precision issues.
+		polygon_aabbs[i] = aabb.grow(CMP_EPSILON);
+		polygon_bvh_indices[i] = i;
+	}
+
+	// A binary tree with single polygon leaves has at most 2n - 1 nodes.
+	polygon_bvh_nodes.reserve(polygons.size() * 2);
+	polygon_bvh_nodes.push_back(PolygonBVHNode());
+	_build_polygon_bvh_node(0, 0, polygons.size(), polygon_aabbs);
+}
+
+void NavMap::_build_polygon_bvh_node(uint32_t p_node_index, uint32_t p_begin, uint32_t p_end, const LocalVector<AABB> &p_polygon_aabbs) {
+	AABB aabb = p_polygon_aabbs[polygon_bvh_indices[p_begin]];
+	AABB center_bounds(aabb.get_center(), Vector3());
+	for (uint32_t i = p_begin + 1; i < p_end; i++) {
+		const AABB &polygon_aabb = p_polygon_aabbs[polygon_bvh_indices[i]];
+		aabb.merge_with(polygon_aabb);
+		center_bounds.expand_to(polygon_aabb.get_center());
+	}
+	polygon_bvh_nodes[p_node_index].aabb = aabb;
+
+	if (p_end - p_begin <= POLYGON_BVH_LEAF_SIZE) {
+		polygon_bvh_nodes[p_node_index].first = p_begin;
+		polygon_bvh_nodes[p_node_index].count = p_end - p_begin;
+		return;
+	}
+
+	// Split at the median along the axis where the polygon centers are the most spread out.
+	// Always splitting at the median keeps the depth logarithmic, which bounds the query stack size.
+	SortArray<uint32_t, PolygonBVHCenterComparator> sorter;
+	sorter.compare.aabbs = p_polygon_aabbs.ptr();
+	sorter.compare.axis = center_bounds.get_longest_axis_index();
+	const uint32_t middle = (p_begin + p_end) / 2;
+	sorter.nth_element(p_begin, p_end, middle, polygon_bvh_indices.ptr());
+
+	const uint32_t first_child = polygon_bvh_nodes.size();
+	polygon_bvh_nodes.push_back(PolygonBVHNode());
+	polygon_bvh_nodes.push_back(PolygonBVHNode());
+	polygon_bvh_nodes[p_node_index].first = first_child;
+	polygon_bvh_nodes[p_node_index].count = 0;
+
+	_build_polygon_bvh_node(first_child, p_begin, middle, p_polygon_aabbs);
+	_build_polygon_bvh_node(first_child + 1, middle, p_end, p_polygon_aabbs);
+}
+
+uint32_t NavMap::_get_region_graph_node(const NavBase *p_owner) {
+	HashMap<const NavBase *, uint32_t>::Iterator E = region_graph_indices.find(p_owner);
+	if (E) {
+		return E->value;
+	}
+
+	const uint32_t node_index = region_graph.size();
+	region_graph.push_back(RegionGraphNode());
+	region_graph[node_index].owner = p_owner;
+	region_graph_indices.insert(p_owner, node_index);
+	return node_index;
+}
+
+void NavMap::_build_region_graph(uint32_t p_link_polygon_count) {
+	region_graph.clear();
+	region_graph_indices.clear();
+
+	for (uint32_t i = 0; i < polygons.size() + p_link_polygon_count; i++) {
+		const gd::Polygon &polygon = i < polygons.size() ? *polygons[i] : link_polygons[i - polygons.size()];
+		const uint32_t node_index = _get_region_graph_node(polygon.owner);
+		region_graph[node_index].center += polygon.center;
+		region_graph[node_index].polygon_count++;
+
+		// Connect the owners of the polygons which are connected.
+		for (const gd::Edge &edge : polygon.edges) {
+			for (const gd::Edge::Connection &connection : edge.connections) {
+				if (connection.polygon->owner == polygon.owner) {
+					continue;
+				}
+				const uint32_t neighbor_index = _get_region_graph_node(connection.polygon->owner);
+				if (region_graph[node_index].neighbors.find(neighbor_index) == -1) {
+					region_graph[node_index].neighbors.push_back(neighbor_index);
+				}
+			}
+		}
+	}
+
+	for (RegionGraphNode &node : region_graph) {
+		if (node.polygon_count > 0) {
+			node.center /= real_t(node.polygon_count);
+		}
+	}
+}
+
+bool NavMap::_get_region_route(const NavBase *p_begin_owner, const NavBase *p_end_owner, uint32_t p_navigation_layers, HashSet<const NavBase *> &r_route_owners) const {
+	HashMap<const NavBase *, uint32_t>::ConstIterator begin = region_graph_indices.find(p_begin_owner);
+	HashMap<const NavBase *, uint32_t>::ConstIterator end = region_graph_indices.find(p_end_owner);
+	if (!begin || !end) {
+		return false;
+	}
+	const uint32_t end_index = end->value;
+	const Vector3 &end_center = region_graph[end_index].center;
+
+	LocalVector<real_t> distances;
+	LocalVector<int64_t> previous;
+	LocalVector<bool> closed;
+	distances.resize(region_graph.size());
+	previous.resize(region_graph.size());
+	closed.resize(region_graph.size());
+	for (uint32_t i = 0; i < region_graph.size(); i++) {
+		distances[i] = FLT_MAX;
+		previous[i] = -1;
+		closed[i] = false;
+	}
+
+	// This is an implementation of the A* algorithm on the region graph, using the region centers as positions.
+	LocalVector<uint32_t> to_visit;
+	to_visit.push_back(begin->value);
+	distances[begin->value] = 0.0;
+
+	while (!to_visit.is_empty()) {
+		// The region graph is small, a linear search for the least cost node is enough.
+		uint32_t least_cost_position = 0;
+		real_t least_cost = FLT_MAX;
+		for (uint32_t i = 0; i < to_visit.size(); i++) {
+			const real_t cost = distances[to_visit[i]] + region_graph[to_visit[i]].center.distance_to(end_center);
+			if (cost < least_cost) {
+				least_cost = cost;
+				least_cost_position = i;
+			}
+		}
+
+		const uint32_t node_index = to_visit[least_cost_position];
+		to_visit.remove_at_unordered(least_cost_position);
+
+		if (node_index == end_index) {
+			for (int64_t i = end_index; i != -1; i = previous[i]) {
+				r_route_owners.insert(region_graph[i].owner);
+			}
+			return true;
+		}
+		closed[node_index] = true;
+
+		const RegionGraphNode &node = region_graph[node_index];
+		for (uint32_t neighbor_index : node.neighbors) {
+			const RegionGraphNode &neighbor = region_graph[neighbor_index];
+			if (closed[neighbor_index] || (p_navigation_layers & neighbor.owner->get_navigation_layers()) == 0) {
+				continue;
+			}
+
+			const real_t distance = distances[node_index] + node.center.distance_to(neighbor.center) * node.owner->get_travel_cost() + neighbor.owner->get_enter_cost();
+			if (distance < distances[neighbor_index]) {
+				if (distances[neighbor_index] == FLT_MAX) {
+					to_visit.push_back(neighbor_index);
+				}
+				distances[neighbor_index] = distance;
+				previous[neighbor_index] = node_index;
+			}
+		}
+	}
+
+	return false;
+}
+
+int64_t NavMap::_get_closest_polygon_index(const Vector3 &p_point, real_t p_max_distance, bool p_filter_layers, uint32_t p_navigation_layers, Vector3 &r_closest_point, Vector3 *r_normal) const {
+	int64_t closest_polygon_index = -1;
+	real_t closest_point_ds = p_max_distance * p_max_distance;
+
+	if (polygon_bvh_nodes.is_empty()) {
+		return closest_polygon_index;
+	}
+
+	const AABB point_aabb(p_point, Vector3());
+	uint32_t stack[POLYGON_BVH_STACK_SIZE];
+	uint32_t stack_size = 0;
+	stack[stack_size++] = 0;
+
+	while (stack_size > 0) {
+		const PolygonBVHNode &node = polygon_bvh_nodes[stack[--stack_size]];
+		// Nodes at the same distance are still visited, a polygon with a lower index may be in them.
+		if (_aabb_distance_squared(node.aabb, point_aabb) > closest_point_ds) {
+			continue;
+		}
+
+		if (node.count == 0) {
+			_push_polygon_bvh_children(polygon_bvh_nodes, node, point_aabb, stack, stack_size);
+			continue;
+		}
+
+		for (uint32_t i = node.first; i < node.first + node.count; i++) {
+			const uint32_t polygon_index = polygon_bvh_indices[i];
+			const gd::Polygon &p = *polygons[polygon_index];
+
+			// Only consider the polygon if it in a region with compatible layers.
+			if (p_filter_layers && (p_navigation_layers & p.owner->get_navigation_layers()) == 0) {
+				continue;
+			}
+
+			// For each face check the distance to the point
+			for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
+				const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
+				const Vector3 inters = f.get_closest_point_to(p_point);
+				const real_t ds = inters.distance_squared_to(p_point);
+				// Ties go to the lowest polygon index so the result does not depend on the traversal order.
+				if (ds < closest_point_ds || (ds == closest_point_ds && closest_polygon_index != -1 && polygon_index < closest_polygon_index)) {
+					r_closest_point = inters;
+					if (r_normal) {
+						*r_normal = f.get_plane().normal;
+					}
+					closest_point_ds = ds;
+					closest_polygon_index = polygon_index;
+				}
+			}
+		}
+	}
+
+	return closest_polygon_index;
+}
+
 void NavMap::_update_merge_rasterizer_cell_dimensions() {
 	merge_rasterizer_cell_size = cell_size * merge_rasterizer_cell_scale;
 	merge_rasterizer_cell_height = cell_height * merge_rasterizer_cell_scale;
@@ -34,8 +34,11 @@
 #include "nav_rid.h"
 #include "nav_utils.h"
 
+#include "core/math/aabb.h"
 #include "core/math/math_defs.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/pair.h"
 
 #include <KdTree2d.h>
 #include <KdTree3d.h>
@@ -71,18 +74,66 @@ class NavMap : public NavRid {
 	/// This value is used to limit how far links search to find polygons to connect to.
 	real_t link_connection_radius = 1.0;
 
+	/// Search the region graph first and only the polygons along the found route then.
+	/// Trades path length for fewer expanded polygons: the route is chosen from the region centers and may not contain the shortest path.
+	bool use_hierarchical_pathfinding = false;
+
 	bool regenerate_polygons = true;
 	bool regenerate_links = true;
 
 	/// Map regions
 	LocalVector<NavRegion *> regions;
 
+	/// Regions removed since the last sync, their polygons still need to be disconnected.
+	/// Only used as keys, the regions may already be freed.
+	LocalVector<const NavRegion *> removed_regions;
+
 	/// Map links
 	LocalVector<NavLink *> links;
 	LocalVector<gd::Polygon> link_polygons;
+	bool links_dirty = true;
+
+	/// Region polygons the links entries were added to, to remove those on the next sync.
+	LocalVector<gd::Polygon *> link_connected_polygons;
+
+	/// Map copy of the polygons of each enabled region, with their connections.
+	/// Kept between syncs so only the changed regions need to be reconnected.
+	struct RegionPolygons {
+		LocalVector<gd::Polygon> polygons;
+		/// Edges merged between two polygons of the region.
+		uint32_t internal_edge_count = 0;
+	};
+	HashMap<const NavRegion *, RegionPolygons> region_polygons;
+
+	/// Region polygon edges that are not merged inside their own region, grouped per key.
+	/// Those are the only edges that can connect to the other regions.
+	HashMap<gd::EdgeKey, LocalVector<gd::Edge::Connection>, gd::EdgeKey> border_edges;
 
 	/// Map polygons
-	LocalVector<gd::Polygon> polygons;
+	LocalVector<gd::Polygon *> polygons;
+
+	/// Bounding volume hierarchy over the map polygons, rebuilt with them on sync.
+	/// Closest point queries traverse it instead of testing every polygon.
+	struct PolygonBVHNode {
+		AABB aabb;
+		/// Internal nodes: index of the first of the two consecutive children.
+		/// Leaves: index of the first entry in `polygon_bvh_indices`.
+		uint32_t first = 0;
+		/// Number of polygons in a leaf, 0 for internal nodes.
+		uint32_t count = 0;
+	};
+	LocalVector<PolygonBVHNode> polygon_bvh_nodes;
+	LocalVector<uint32_t> polygon_bvh_indices;
+
+	/// Graph of the connected regions and links, rebuilt with the polygon connections when hierarchical pathfinding is used.
+	struct RegionGraphNode {
+		const NavBase *owner = nullptr;
+		Vector3 center;
+		uint32_t polygon_count = 0;
+		LocalVector<uint32_t> neighbors;
+	};
+	LocalVector<RegionGraphNode> region_graph;
+	HashMap<const NavBase *, uint32_t> region_graph_indices;
 
 	/// RVO avoidance worlds
 	RVO2D::RVOSimulator2D rvo_simulation_2d;
@@ -163,9 +214,14 @@ public:
 		return link_connection_radius;
 	}
 
+	void set_use_hierarchical_pathfinding(bool p_enabled);
+	bool get_use_hierarchical_pathfinding() const {
+		return use_hierarchical_pathfinding;
+	}
+
 	gd::PointKey get_point_key(const Vector3 &p_pos) const;
 
-	Vector<Vector3> get_path(Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners) const;
+	Vector<Vector3> get_path(Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners, int *r_expanded_polygon_count = nullptr) const;
 	Vector3 get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const;
 	Vector3 get_closest_point(const Vector3 &p_point) const;
 	Vector3 get_closest_point_normal(const Vector3 &p_point) const;
@@ -230,6 +286,21 @@ private:
 	void _update_rvo_agents_tree_3d();
 
 	void _update_merge_rasterizer_cell_dimensions();
+
+	void _build_polygon_bvh();
+	void _build_polygon_bvh_node(uint32_t p_node_index, uint32_t p_begin, uint32_t p_end, const LocalVector<AABB> &p_polygon_aabbs);
+	void _purge_owner_connections(const HashSet<const NavBase *> &p_owners);
+	void _disconnect_region_polygons(LocalVector<gd::Polygon> &r_polygons, HashSet<gd::EdgeKey, gd::EdgeKey> &r_changed_edge_keys);
+	void _connect_region_polygons(RegionPolygons &r_region_polygons, HashSet<gd::EdgeKey, gd::EdgeKey> &r_changed_edge_keys);
+	void _clear_edge_connections(gd::Polygon &r_polygon, int p_edge);
+	void _purge_edge_connections(const HashSet<Pair<const gd::Polygon *, int>, PairHash<const gd::Polygon *, int>> &p_edges);
+	void _connect_free_edge(const gd::Edge::Connection &p_free_edge, const gd::Edge::Connection &p_other_edge);
+
+	uint32_t _get_region_graph_node(const NavBase *p_owner);
+	void _build_region_graph(uint32_t p_link_polygon_count);
+	bool _get_region_route(const NavBase *p_begin_owner, const NavBase *p_end_owner, uint32_t p_navigation_layers, HashSet<const NavBase *> &r_route_owners) const;
+
+	int64_t _get_closest_polygon_index(const Vector3 &p_point, real_t p_max_distance, bool p_filter_layers, uint32_t p_navigation_layers, Vector3 &r_closest_point, Vector3 *r_normal = nullptr) const;
 };
 
 #endif // NAV_MAP_H
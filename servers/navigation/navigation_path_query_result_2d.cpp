@@ -62,11 +62,20 @@ const Vector<int64_t> &NavigationPathQueryResult2D::get_path_owner_ids() const {
 	return path_owner_ids;
 }
 
+void NavigationPathQueryResult2D::set_expanded_polygon_count(int p_expanded_polygon_count) {
+	expanded_polygon_count = p_expanded_polygon_count;
+}
+
+int NavigationPathQueryResult2D::get_expanded_polygon_count() const {
+	return expanded_polygon_count;
+}
+
 void NavigationPathQueryResult2D::reset() {
 	path.clear();
 	path_types.clear();
 	path_rids.clear();
 	path_owner_ids.clear();
+	expanded_polygon_count = 0;
 }
 
 void NavigationPathQueryResult2D::_bind_methods() {
@@ -82,12 +91,16 @@ void NavigationPathQueryResult2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_path_owner_ids", "path_owner_ids"), &NavigationPathQueryResult2D::set_path_owner_ids);
 	ClassDB::bind_method(D_METHOD("get_path_owner_ids"), &NavigationPathQueryResult2D::get_path_owner_ids);
 
+	ClassDB::bind_method(D_METHOD("set_expanded_polygon_count", "expanded_polygon_count"), &NavigationPathQueryResult2D::set_expanded_polygon_count);
+	ClassDB::bind_method(D_METHOD("get_expanded_polygon_count"), &NavigationPathQueryResult2D::get_expanded_polygon_count);
+
 	ClassDB::bind_method(D_METHOD("reset"), &NavigationPathQueryResult2D::reset);
 
 	ADD_PROPERTY(PropertyInfo(Variant::PACKED_VECTOR2_ARRAY, "path"), "set_path", "get_path");
 	ADD_PROPERTY(PropertyInfo(Variant::PACKED_INT32_ARRAY, "path_types"), "set_path_types", "get_path_types");
 	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "path_rids", PROPERTY_HINT_ARRAY_TYPE, "RID"), "set_path_rids", "get_path_rids");
 	ADD_PROPERTY(PropertyInfo(Variant::PACKED_INT64_ARRAY, "path_owner_ids"), "set_path_owner_ids", "get_path_owner_ids");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "expanded_polygon_count"), "set_expanded_polygon_count", "get_expanded_polygon_count");
 
 	BIND_ENUM_CONSTANT(PATH_SEGMENT_TYPE_REGION);
 	BIND_ENUM_CONSTANT(PATH_SEGMENT_TYPE_LINK);
@@ -41,6 +41,7 @@ class NavigationPathQueryResult2D : public RefCounted {
 	Vector<int32_t> path_types;
 	TypedArray<RID> path_rids;
 	Vector<int64_t> path_owner_ids;
+	int expanded_polygon_count = 0;
 
 protected:
 	static void _bind_methods();
@@ -63,6 +64,9 @@ public:
 	void set_path_owner_ids(const Vector<int64_t> &p_path_owner_ids);
 	const Vector<int64_t> &get_path_owner_ids() const;
 
+	void set_expanded_polygon_count(int p_expanded_polygon_count);
+	int get_expanded_polygon_count() const;
+
 	void reset();
 };
 
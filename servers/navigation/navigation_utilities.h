@@ -75,6 +75,7 @@ struct PathQueryResult {
 	PackedInt32Array path_types;
 	TypedArray<RID> path_rids;
 	PackedInt64Array path_owner_ids;
+	int expanded_polygon_count = 0;
 };
 
 } //namespace NavigationUtilities
@@ -32,6 +32,7 @@
 #define NAVIGATION_SERVER_3D_H
 
 #include "core/object/class_db.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rid.h"
 
 #include "scene/resources/3d/navigation_mesh_source_geometry_data_3d.h"
@@ -90,6 +91,11 @@ public:
 	virtual void map_set_use_edge_connections(RID p_map, bool p_enabled) = 0;
 	virtual bool map_get_use_edge_connections(RID p_map) const = 0;
 
+	/// Search a graph of the connected regions and links first, then only the polygons of the regions and links along the found route.
+	/// This expands fewer polygons on large maps, but the route is chosen from the region centers, so the path can be longer than the shortest one.
+	virtual void map_set_use_hierarchical_pathfinding(RID p_map, bool p_enabled) = 0;
+	virtual bool map_get_use_hierarchical_pathfinding(RID p_map) const = 0;
+
 	/// Set the map edge connection margin used to weld the compatible region edges.
 	virtual void map_set_edge_connection_margin(RID p_map, real_t p_connection_margin) = 0;
 
@@ -344,10 +350,20 @@ public:
 
 	virtual NavigationUtilities::PathQueryResult _query_path(const NavigationUtilities::PathQueryParameters &p_parameters) const = 0;
 
+	/// Queues many path queries at once. They run in parallel against the synchronized maps
+	/// and the callback receives their results during a later server process.
+	virtual void query_path_batch(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const Callable &p_callback) = 0;
+
+	/// Converts the results of a query batch to the server specific result objects and calls the user callback.
+	typedef void (*PathQueryBatchCompletedCallback)(const LocalVector<NavigationUtilities::PathQueryResult> &p_results, const Callable &p_callback);
+	virtual void _query_path_batch(const LocalVector<NavigationUtilities::PathQueryParameters> &p_parameters, PathQueryBatchCompletedCallback p_completed_callback, const Callable &p_callback) = 0;
+
 #ifndef _3D_DISABLED
 	virtual void parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable()) = 0;
 	virtual void bake_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) = 0;
 	virtual void bake_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) = 0;
+	virtual void bake_tiles_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback = Callable()) = 0;
+	virtual void bake_tiles_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback = Callable()) = 0;
 	virtual bool is_baking_navigation_mesh(Ref<NavigationMesh> p_navigation_mesh) const = 0;
 #endif // _3D_DISABLED
 
@@ -291,9 +291,32 @@ bool GodotBodyPair2D::setup(real_t p_step) {
 		motion_B = B->get_motion();
 	}
 
+	// Resting contacts: the collision test would find the same contacts again.
+	bool can_cache_contacts = motion_A == Vector2() && motion_B == Vector2();
+	if (can_cache_contacts && contacts_cached && collided && !oneway_disabled && contact_count > 0 &&
+			xform_A.is_equal_approx(cached_xform_A) && xform_B.is_equal_approx(cached_xform_B) &&
+			shape_A_ptr == cached_shape_A && shape_B_ptr == cached_shape_B &&
+			shape_A_ptr->get_version() == cached_shape_version_A && shape_B_ptr->get_version() == cached_shape_version_B) {
+		for (int i = 0; i < contact_count; i++) {
+			contacts[i].used = true;
+		}
+		return true;
+	}
+
 	bool prev_collided = collided;
 
 	collided = GodotCollisionSolver2D::solve(shape_A_ptr, xform_A, motion_A, shape_B_ptr, xform_B, motion_B, _add_contact, this, &sep_axis);
+
+	contacts_cached = collided && can_cache_contacts;
+	if (contacts_cached) {
+		cached_xform_A = xform_A;
+		cached_xform_B = xform_B;
+		cached_shape_A = shape_A_ptr;
+		cached_shape_B = shape_B_ptr;
+		cached_shape_version_A = shape_A_ptr->get_version();
+		cached_shape_version_B = shape_B_ptr->get_version();
+	}
+
 	if (!collided) {
 		oneway_disabled = false;
 
@@ -84,6 +84,15 @@ class GodotBodyPair2D : public GodotConstraint2D {
 	bool oneway_disabled = false;
 	bool report_contacts_only = false;
 
+	// Shapes the contacts were last found with. While they neither move nor change, the collision test is skipped and the contacts are kept.
+	bool contacts_cached = false;
+	Transform2D cached_xform_A;
+	Transform2D cached_xform_B;
+	const GodotShape2D *cached_shape_A = nullptr;
+	const GodotShape2D *cached_shape_B = nullptr;
+	uint32_t cached_shape_version_A = 0;
+	uint32_t cached_shape_version_B = 0;
+
 	bool _test_ccd(real_t p_step, GodotBody2D *p_A, int p_shape_A, const Transform2D &p_xform_A, GodotBody2D *p_B, int p_shape_B, const Transform2D &p_xform_B);
 	void _validate_contacts();
 	static void _add_contact(const Vector2 &p_point_A, const Vector2 &p_point_B, void *p_self);
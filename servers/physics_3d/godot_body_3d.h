@@ -108,6 +108,10 @@ class GodotBody3D : public GodotCollisionObject3D {
 	bool can_sleep = true;
 	bool first_time_kinematic = false;
 
+	// Motion the shapes are extended with once the forces are integrated.
+	Vector3 integrated_motion;
+	bool integrated_motion_pending = false;
+
 	void _mass_properties_changed();
 	virtual void _shapes_changed() override;
 	Transform3D new_transform;
@@ -316,8 +320,12 @@ public:
 	void set_axis_lock(PhysicsServer3D::BodyAxis p_axis, bool lock);
 	bool is_axis_locked(PhysicsServer3D::BodyAxis p_axis) const;
 
+	// The integration can run on threads for different bodies. The changes to the broadphase and the space lists
+	// are only made by the matching apply functions, which must be called afterwards from a single thread.
 	void integrate_forces(real_t p_step);
+	void apply_integrated_forces();
 	void integrate_velocities(real_t p_step);
+	void apply_integrated_velocities();
 
 	_FORCE_INLINE_ Vector3 get_velocity_in_local_point(const Vector3 &rel_pos) const {
 		return linear_velocity + angular_velocity.cross(rel_pos - center_of_mass);
@@ -34,6 +34,7 @@
 #include "godot_physics_server_3d.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
@@ -108,14 +109,22 @@ int GodotPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_par
 bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
 	ERR_FAIL_COND_V(space->locked, false);
 
+	return _intersect_ray(p_parameters, r_result, space->intersection_query_results, space->intersection_query_subindex_results);
+}
+
+bool GodotPhysicsDirectSpaceState3D::_intersect_ray(const RayParameters &p_parameters, RayResult &r_result, GodotCollisionObject3D **r_cull_results, int *r_cull_subindices) {
+	int amount = space->broadphase->cull_segment(p_parameters.from, p_parameters.to, r_cull_results, GodotSpace3D::INTERSECTION_QUERY_MAX, r_cull_subindices);
+
+	return _intersect_ray_candidates(p_parameters, r_result, r_cull_results, r_cull_subindices, amount);
+}
+
+bool GodotPhysicsDirectSpaceState3D::_intersect_ray_candidates(const RayParameters &p_parameters, RayResult &r_result, GodotCollisionObject3D *const *p_candidates, const int *p_candidate_subindices, int p_candidate_count) {
 	Vector3 begin, end;
 	Vector3 normal;
 	begin = p_parameters.from;
 	end = p_parameters.to;
 	normal = (end - begin).normalized();
 
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
-
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
 	bool collided = false;
@@ -125,22 +134,22 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	const GodotCollisionObject3D *res_obj = nullptr;
 	real_t min_d = 1e10;
 
-	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+	for (int i = 0; i < p_candidate_count; i++) {
+		if (!_can_collide_with(p_candidates[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.pick_ray && !(space->intersection_query_results[i]->is_ray_pickable())) {
+		if (p_parameters.pick_ray && !(p_candidates[i]->is_ray_pickable())) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_candidates[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject3D *col_obj = p_candidates[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = p_candidate_subindices[i];
 		Transform3D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
 		Vector3 local_from = inv_xform.xform(begin);
@@ -205,6 +214,94 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	return true;
 }
 
+void GodotPhysicsDirectSpaceState3D::_intersect_ray_batch(uint32_t p_index, RayBatch *p_batch) {
+	// Each task culls into its own buffers, so the tasks don't share the space's query results.
+	GodotCollisionObject3D *cull_results[GodotSpace3D::INTERSECTION_QUERY_MAX];
+	int cull_subindices[GodotSpace3D::INTERSECTION_QUERY_MAX];
+	int cull_segments[GodotSpace3D::INTERSECTION_QUERY_MAX];
+
+	// Culled results regrouped per ray.
+	GodotCollisionObject3D *ray_results[GodotSpace3D::INTERSECTION_QUERY_MAX];
+	int ray_subindices[GodotSpace3D::INTERSECTION_QUERY_MAX];
+	int ray_offsets[RAY_BATCH_PACKET_SIZE + 1];
+
+	RayParameters parameters = *p_batch->parameters;
+
+	const int begin = p_index * RAY_BATCH_TASK_SIZE;
+	const int end = MIN(begin + RAY_BATCH_TASK_SIZE, p_batch->ray_count);
+	for (int packet_begin = begin; packet_begin < end; packet_begin += RAY_BATCH_PACKET_SIZE) {
+		const int packet_size = MIN((int)RAY_BATCH_PACKET_SIZE, end - packet_begin);
+
+		// Neighboring rays mostly visit the same broadphase nodes, so cull them together.
+		int amount = space->broadphase->cull_segments(p_batch->from + packet_begin, p_batch->to + packet_begin, packet_size, cull_results, cull_segments, GodotSpace3D::INTERSECTION_QUERY_MAX, cull_subindices);
+
+		if (amount >= GodotSpace3D::INTERSECTION_QUERY_MAX) {
+			// The packet shares the result buffer, so some rays may have been cut short. Cull them one by one.
+			for (int i = packet_begin; i < packet_begin + packet_size; i++) {
+				parameters.from = p_batch->from[i];
+				parameters.to = p_batch->to[i];
+				p_batch->hits[i] = _intersect_ray(parameters, p_batch->results[i], cull_results, cull_subindices);
+			}
+			continue;
+		}
+
+		// Counting sort by ray, keeping the broadphase order within each ray.
+		for (int i = 0; i <= packet_size; i++) {
+			ray_offsets[i] = 0;
+		}
+		for (int i = 0; i < amount; i++) {
+			ray_offsets[cull_segments[i] + 1]++;
+		}
+		for (int i = 0; i < packet_size; i++) {
+			ray_offsets[i + 1] += ray_offsets[i];
+		}
+		for (int i = 0; i < amount; i++) {
+			int &slot = ray_offsets[cull_segments[i]];
+			ray_results[slot] = cull_results[i];
+			ray_subindices[slot] = cull_subindices[i];
+			slot++;
+		}
+
+		// Each offset now points at the end of its ray's range, which is where the next one starts.
+		int ray_begin = 0;
+		for (int i = 0; i < packet_size; i++) {
+			const int ray = packet_begin + i;
+			parameters.from = p_batch->from[ray];
+			parameters.to = p_batch->to[ray];
+			p_batch->hits[ray] = _intersect_ray_candidates(parameters, p_batch->results[ray], ray_results + ray_begin, ray_subindices + ray_begin, ray_offsets[i] - ray_begin);
+			ray_begin = ray_offsets[i];
+		}
+	}
+}
+
+int GodotPhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, bool *r_hits) {
+	ERR_FAIL_COND_V(space->locked, 0);
+
+	if (p_ray_count < RAY_BATCH_MIN_PARALLEL_SIZE) {
+		return PhysicsDirectSpaceState3D::intersect_rays(p_parameters, p_from, p_to, p_ray_count, r_results, r_hits);
+	}
+
+	RayBatch batch;
+	batch.parameters = &p_parameters;
+	batch.from = p_from;
+	batch.to = p_to;
+	batch.ray_count = p_ray_count;
+	batch.results = r_results;
+	batch.hits = r_hits;
+
+	const uint32_t task_count = Math::division_round_up((uint32_t)p_ray_count, (uint32_t)RAY_BATCH_TASK_SIZE);
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState3D::_intersect_ray_batch, &batch, task_count, -1, true, SNAME("Physics3DIntersectRays"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	int hit_count = 0;
+	for (int i = 0; i < p_ray_count; i++) {
+		if (r_hits[i]) {
+			hit_count++;
+		}
+	}
+	return hit_count;
+}
+
 int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
 	if (p_result_max <= 0) {
 		return 0;
@@ -46,11 +46,33 @@
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
 	GDCLASS(GodotPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3D);
 
+	enum {
+		// Smaller batches are cast on the calling thread.
+		RAY_BATCH_MIN_PARALLEL_SIZE = 256,
+		RAY_BATCH_TASK_SIZE = 64,
+		// Rays of a task are culled against the broadphase in packets of this size.
+		RAY_BATCH_PACKET_SIZE = 32,
+	};
+
+	struct RayBatch {
+		const RayParameters *parameters = nullptr;
+		const Vector3 *from = nullptr;
+		const Vector3 *to = nullptr;
+		int ray_count = 0;
+		RayResult *results = nullptr;
+		bool *hits = nullptr;
+	};
+
+	bool _intersect_ray(const RayParameters &p_parameters, RayResult &r_result, GodotCollisionObject3D **r_cull_results, int *r_cull_subindices);
+	bool _intersect_ray_candidates(const RayParameters &p_parameters, RayResult &r_result, GodotCollisionObject3D *const *p_candidates, const int *p_candidate_subindices, int p_candidate_count);
+	void _intersect_ray_batch(uint32_t p_index, RayBatch *p_batch);
+
 public:
 	GodotSpace3D *space = nullptr;
 
 	virtual int intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
 	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) override;
+	virtual int intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, bool *r_hits) override;
 	virtual int intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
 	virtual bool cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info = nullptr) override;
 	virtual bool collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) override;
@@ -32,6 +32,7 @@
 
 #include "godot_joint_3d.h"
 
+#include "core/config/project_settings.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
@@ -40,6 +41,7 @@
 #define ISLAND_COUNT_RESERVE 128
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+#define COLOR_BATCH_MIN_PARALLEL_SIZE 32
 
 void GodotStep3D::_populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
@@ -132,6 +134,9 @@ void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constrai
 
 void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[p_island_index];
+	if (_is_island_solved_in_batches(constraint_island)) {
+		return; // Solved after the other islands, see _solve_island_in_batches().
+	}
 
 	int current_priority = 1;
 
@@ -158,26 +163,145 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	}
 }
 
-void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const {
+bool GodotStep3D::_is_island_solved_in_batches(const LocalVector<GodotConstraint3D *> &p_constraint_island) const {
+	return parallel_island_solve_threshold > 0 && p_constraint_island.size() >= parallel_island_solve_threshold;
+}
+
+void GodotStep3D::_color_constraints(const LocalVector<GodotConstraint3D *> &p_constraints, uint32_t p_constraint_count) {
+	// Greedy coloring in island order, so the batches are the same for the same island.
+	// Only dynamic bodies are written to while solving, so other bodies can be shared within a batch.
+	// Constraints that don't fit in any color go to an extra batch which is solved serially.
+	body_colors.clear();
+	constraint_colors.resize(p_constraint_count);
+
+	uint32_t color_sizes[MAX_CONSTRAINT_COLORS + 1] = {};
+
+	for (uint32_t constraint_index = 0; constraint_index < p_constraint_count; ++constraint_index) {
+		GodotConstraint3D *constraint = p_constraints[constraint_index];
+
+		uint64_t used_colors = 0;
+		for (int i = 0; i < constraint->get_body_count(); i++) {
+			const GodotBody3D *body = constraint->get_body_ptr()[i];
+			if (body->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC) {
+				const uint64_t *colors = body_colors.getptr(body);
+				used_colors |= colors ? *colors : 0;
+			}
+		}
+		for (int i = 0; i < constraint->get_soft_body_count(); i++) {
+			const uint64_t *colors = body_colors.getptr(constraint->get_soft_body_ptr(i));
+			used_colors |= colors ? *colors : 0;
+		}
+
+		uint32_t color = 0;
+		while (color < MAX_CONSTRAINT_COLORS && (used_colors & (uint64_t(1) << color))) {
+			color++;
+		}
+
+		if (color < MAX_CONSTRAINT_COLORS) {
+			for (int i = 0; i < constraint->get_body_count(); i++) {
+				const GodotBody3D *body = constraint->get_body_ptr()[i];
+				if (body->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC) {
+					body_colors[body] |= uint64_t(1) << color;
+				}
+			}
+			for (int i = 0; i < constraint->get_soft_body_count(); i++) {
+				body_colors[constraint->get_soft_body_ptr(i)] |= uint64_t(1) << color;
+			}
+		}
+
+		constraint_colors[constraint_index] = color;
+		color_sizes[color]++;
+	}
+
+	color_offsets.resize(MAX_CONSTRAINT_COLORS + 2);
+	color_offsets[0] = 0;
+	for (uint32_t color = 0; color <= MAX_CONSTRAINT_COLORS; ++color) {
+		color_offsets[color + 1] = color_offsets[color] + color_sizes[color];
+		color_sizes[color] = color_offsets[color]; // Reused as insertion positions.
+	}
+
+	colored_constraints.resize(p_constraint_count);
+	for (uint32_t constraint_index = 0; constraint_index < p_constraint_count; ++constraint_index) {
+		colored_constraints[color_sizes[constraint_colors[constraint_index]]++] = p_constraints[constraint_index];
+	}
+}
+
+void GodotStep3D::_solve_colored_constraint(uint32_t p_constraint_index, void *p_userdata) {
+	colored_constraints[*(const uint32_t *)p_userdata + p_constraint_index]->solve(delta);
+}
+
+void GodotStep3D::_solve_island_in_batches(LocalVector<GodotConstraint3D *> &p_constraint_island) {
+	int current_priority = 1;
+
+	uint32_t constraint_count = p_constraint_island.size();
+	while (constraint_count > 0) {
+		_color_constraints(p_constraint_island, constraint_count);
+
+		for (int i = 0; i < iterations; i++) {
+			// Go through all iterations, solving one batch after another.
+			for (uint32_t color = 0; color <= MAX_CONSTRAINT_COLORS; ++color) {
+				uint32_t batch_begin = color_offsets[color];
+				uint32_t batch_size = color_offsets[color + 1] - batch_begin;
+				if (color < MAX_CONSTRAINT_COLORS && batch_size >= COLOR_BATCH_MIN_PARALLEL_SIZE) {
+					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_colored_constraint, (void *)&batch_begin, batch_size, -1, true, SNAME("Physics3DConstraintSolveBatch"));
+					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+				} else {
+					for (uint32_t constraint_index = batch_begin; constraint_index < batch_begin + batch_size; ++constraint_index) {
+						colored_constraints[constraint_index]->solve(delta);
+					}
+				}
+			}
+		}
+
+		// Check priority to keep only higher priority constraints.
+		uint32_t priority_constraint_count = 0;
+		++current_priority;
+		for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+			GodotConstraint3D *constraint = p_constraint_island[constraint_index];
+			if (constraint->get_priority() >= current_priority) {
+				// Keep this constraint for the next iteration.
+				p_constraint_island[priority_constraint_count++] = constraint;
+			}
+		}
+		constraint_count = priority_constraint_count;
+	}
+}
+
+void GodotStep3D::_integrate_forces(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_forces(delta);
+}
+
+void GodotStep3D::_integrate_velocities(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_velocities(delta);
+}
+
+void GodotStep3D::_sleep_test_island(uint32_t p_island_index, void *p_userdata) {
+	const LocalVector<GodotBody3D *> &body_island = body_islands[p_island_index];
+
 	bool can_sleep = true;
 
-	uint32_t body_count = p_body_island.size();
+	uint32_t body_count = body_island.size();
 	for (uint32_t body_index = 0; body_index < body_count; ++body_index) {
-		GodotBody3D *body = p_body_island[body_index];
+		GodotBody3D *body = body_island[body_index];
 
 		if (!body->sleep_test(delta)) {
 			can_sleep = false;
 		}
 	}
 
+	body_island_can_sleep[p_island_index] = can_sleep;
+}
+
+void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island, bool p_can_sleep) const {
 	// Put all to sleep or wake up everyone.
+	uint32_t body_count = p_body_island.size();
 	for (uint32_t body_index = 0; body_index < body_count; ++body_index) {
 		GodotBody3D *body = p_body_island[body_index];
 
 		bool active = body->is_active();
 
-		if (active == can_sleep) {
-			body->set_active(!can_sleep);
+		if (active == p_can_sleep) {
+			body->set_active(!p_can_sleep);
 		}
 	}
 }
@@ -203,13 +327,22 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	int active_count = 0;
 
+	active_bodies.clear();
 	const SelfList<GodotBody3D> *b = body_list->first();
 	while (b) {
-		b->self()->integrate_forces(p_delta);
+		active_bodies.push_back(b->self());
 		b = b->next();
 		active_count++;
 	}
 
+	// Each body only changes its own state here, the broadphase is updated afterwards.
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_integrate_forces, nullptr, active_bodies.size(), -1, true, SNAME("Physics3DIntegrateForces"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (GodotBody3D *body : active_bodies) {
+		body->apply_integrated_forces();
+	}
+
 	/* UPDATE SOFT BODY MOTION */
 
 	const SelfList<GodotSoftBody3D> *sb = soft_body_list->first();
@@ -344,7 +477,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -367,6 +500,13 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
+	// Large islands are solved here instead, so the batches don't wait on threads busy with other islands.
+	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
+		if (_is_island_solved_in_batches(constraint_islands[island_index])) {
+			_solve_island_in_batches(constraint_islands[island_index]);
+		}
+	}
+
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_SOLVE_CONSTRAINTS, profile_endtime - profile_begtime);
@@ -375,17 +515,31 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* INTEGRATE VELOCITIES */
 
+	// Bodies can be activated while solving, so the list is gathered again.
+	active_bodies.clear();
 	b = body_list->first();
 	while (b) {
-		const SelfList<GodotBody3D> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
-		b = n;
+		active_bodies.push_back(b->self());
+		b = b->next();
+	}
+
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_integrate_velocities, nullptr, active_bodies.size(), -1, true, SNAME("Physics3DIntegrateVelocities"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Kinematic bodies can deactivate here, which is why the active list isn't iterated directly.
+	for (GodotBody3D *body : active_bodies) {
+		body->apply_integrated_velocities();
 	}
 
 	/* SLEEP / WAKE UP ISLANDS */
 
+	// Islands don't share bodies, so they can be tested on threads. Activation changes the space lists, so it's done after.
+	body_island_can_sleep.resize(body_island_count);
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_sleep_test_island, nullptr, body_island_count, -1, true, SNAME("Physics3DSleepTestIslands"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
 	for (uint32_t island_index = 0; island_index < body_island_count; ++island_index) {
-		_check_suspend(body_islands[island_index]);
+		_check_suspend(body_islands[island_index], body_island_can_sleep[island_index]);
 	}
 
 	/* UPDATE SOFT BODY CONSTRAINTS */
@@ -409,6 +563,9 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 }
 
 GodotStep3D::GodotStep3D() {
+	parallel_island_solve_threshold = GLOBAL_GET("physics/3d/solver/parallel_island_solve_threshold");
+
+	active_bodies.reserve(BODY_ISLAND_SIZE_RESERVE);
 	body_islands.reserve(BODY_ISLAND_COUNT_RESERVE);
 	constraint_islands.reserve(ISLAND_COUNT_RESERVE);
 	all_constraints.reserve(CONSTRAINT_COUNT_RESERVE);
@@ -33,24 +33,44 @@
 
 #include "godot_space_3d.h"
 
+#include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
 
 class GodotStep3D {
+	static const uint32_t MAX_CONSTRAINT_COLORS = 64;
+
 	uint64_t _step = 1;
 
 	int iterations = 0;
 	real_t delta = 0.0;
 
+	// Islands with at least this many constraints are solved in batches of constraints that don't share bodies,
+	// each batch on threads. Zero to disable.
+	uint32_t parallel_island_solve_threshold = 0;
+	LocalVector<GodotConstraint3D *> colored_constraints;
+	LocalVector<uint32_t> constraint_colors;
+	LocalVector<uint32_t> color_offsets;
+	HashMap<const void *, uint64_t> body_colors; // Colors used by the constraints of each dynamic body.
+
+	LocalVector<GodotBody3D *> active_bodies;
 	LocalVector<LocalVector<GodotBody3D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint3D *>> constraint_islands;
 	LocalVector<GodotConstraint3D *> all_constraints;
+	LocalVector<uint8_t> body_island_can_sleep;
 
 	void _populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
-	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
+	bool _is_island_solved_in_batches(const LocalVector<GodotConstraint3D *> &p_constraint_island) const;
+	void _color_constraints(const LocalVector<GodotConstraint3D *> &p_constraints, uint32_t p_constraint_count);
+	void _solve_colored_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
+	void _solve_island_in_batches(LocalVector<GodotConstraint3D *> &p_constraint_island);
+	void _integrate_forces(uint32_t p_body_index, void *p_userdata = nullptr);
+	void _integrate_velocities(uint32_t p_body_index, void *p_userdata = nullptr);
+	void _sleep_test_island(uint32_t p_island_index, void *p_userdata = nullptr);
+	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island, bool p_can_sleep) const;
 
 public:
 	void step(GodotSpace3D *p_space, real_t p_delta);
@@ -377,6 +377,68 @@ Dictionary PhysicsDirectSpaceState3D::_intersect_ray(const Ref<PhysicsRayQueryPa
 	return d;
 }
 
+Dictionary PhysicsDirectSpaceState3D::_intersect_rays(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to) {
+	ERR_FAIL_COND_V(!p_ray_query.is_valid(), Dictionary());
+	ERR_FAIL_COND_V_MSG(p_from.size() != p_to.size(), Dictionary(), "The ray start and end arrays must have the same size.");
+
+	const int ray_count = p_from.size();
+
+	Vector<RayResult> results;
+	results.resize(ray_count);
+	Vector<bool> hits;
+	hits.resize(ray_count);
+	intersect_rays(p_ray_query->get_parameters(), p_from.ptr(), p_to.ptr(), ray_count, results.ptrw(), hits.ptrw());
+
+	PackedByteArray hit;
+	PackedVector3Array position;
+	PackedVector3Array normal;
+	PackedInt32Array face_index;
+	PackedInt64Array collider_id;
+	PackedInt32Array shape;
+	Array collider;
+	Array rid;
+	hit.resize(ray_count);
+	position.resize(ray_count);
+	normal.resize(ray_count);
+	face_index.resize(ray_count);
+	collider_id.resize(ray_count);
+	shape.resize(ray_count);
+	collider.resize(ray_count);
+	rid.resize(ray_count);
+
+	for (int i = 0; i < ray_count; i++) {
+		hit.write[i] = hits[i];
+		if (!hits[i]) {
+			position.write[i] = Vector3();
+			normal.write[i] = Vector3();
+			face_index.write[i] = -1;
+			collider_id.write[i] = 0;
+			shape.write[i] = -1;
+			continue;
+		}
+		const RayResult &result = results[i];
+		position.write[i] = result.position;
+		normal.write[i] = result.normal;
+		face_index.write[i] = result.face_index;
+		collider_id.write[i] = (int64_t)result.collider_id;
+		shape.write[i] = result.shape;
+		collider[i] = result.collider;
+		rid[i] = result.rid;
+	}
+
+	Dictionary d;
+	d["hit"] = hit;
+	d["position"] = position;
+	d["normal"] = normal;
+	d["face_index"] = face_index;
+	d["collider_id"] = collider_id;
+	d["collider"] = collider;
+	d["shape"] = shape;
+	d["rid"] = rid;
+
+	return d;
+}
+
 TypedArray<Dictionary> PhysicsDirectSpaceState3D::_intersect_point(const Ref<PhysicsPointQueryParameters3D> &p_point_query, int p_max_results) {
 	ERR_FAIL_COND_V(p_point_query.is_null(), TypedArray<Dictionary>());
 
@@ -422,6 +484,59 @@ TypedArray<Dictionary> PhysicsDirectSpaceState3D::_intersect_shape(const Ref<Phy
 	return ret;
 }
 
+Dictionary PhysicsDirectSpaceState3D::_intersect_shapes(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const TypedArray<Transform3D> &p_transforms, int p_max_results) {
+	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Dictionary());
+	ERR_FAIL_COND_V(p_max_results <= 0, Dictionary());
+
+	const int query_count = p_transforms.size();
+
+	Vector<Transform3D> transforms;
+	transforms.resize(query_count);
+	for (int i = 0; i < query_count; i++) {
+		transforms.write[i] = p_transforms[i];
+	}
+
+	Vector<ShapeResult> sr;
+	sr.resize(query_count * p_max_results);
+	Vector<int> result_counts;
+	result_counts.resize(query_count);
+	int rc = intersect_shapes(p_shape_query->get_parameters(), transforms.ptr(), query_count, sr.ptrw(), p_max_results, result_counts.ptrw());
+
+	// The results of all the queries are packed one after another.
+	PackedInt32Array count;
+	PackedInt64Array collider_id;
+	PackedInt32Array shape;
+	Array collider;
+	Array rid;
+	count.resize(query_count);
+	collider_id.resize(rc);
+	shape.resize(rc);
+	collider.resize(rc);
+	rid.resize(rc);
+
+	int result_index = 0;
+	for (int i = 0; i < query_count; i++) {
+		count.write[i] = result_counts[i];
+		for (int j = 0; j < result_counts[i]; j++) {
+			const ShapeResult &result = sr[i * p_max_results + j];
+			collider_id.write[result_index] = (int64_t)result.collider_id;
+			shape.write[result_index] = result.shape;
+			collider[result_index] = result.collider;
+			rid[result_index] = result.rid;
+			result_index++;
+		}
+	}
+
+	Dictionary d;
+	d["count"] = count;
+	d["collider_id"] = collider_id;
+	d["collider"] = collider;
+	d["shape"] = shape;
+	d["rid"] = rid;
+
+	return d;
+}
+
 Vector<real_t> PhysicsDirectSpaceState3D::_cast_motion(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query) {
 	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Vector<real_t>());
 
@@ -476,13 +591,43 @@ Dictionary PhysicsDirectSpaceState3D::_get_rest_info(const Ref<PhysicsShapeQuery
 	return r;
 }
 
+int PhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, bool *r_hits) {
+	// Copied once, so the excluded objects aren't copied for each ray.
+	RayParameters parameters = p_parameters;
+
+	int hit_count = 0;
+	for (int i = 0; i < p_ray_count; i++) {
+		parameters.from = p_from[i];
+		parameters.to = p_to[i];
+		r_hits[i] = intersect_ray(parameters, r_results[i]);
+		if (r_hits[i]) {
+			hit_count++;
+		}
+	}
+	return hit_count;
+}
+
+int PhysicsDirectSpaceState3D::intersect_shapes(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_query_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	ShapeParameters parameters = p_parameters;
+
+	int result_count = 0;
+	for (int i = 0; i < p_query_count; i++) {
+		parameters.transform = p_transforms[i];
+		r_result_counts[i] = intersect_shape(parameters, r_results + i * p_result_max, p_result_max);
+		result_count += r_result_counts[i];
+	}
+	return result_count;
+}
+
 PhysicsDirectSpaceState3D::PhysicsDirectSpaceState3D() {
 }
 
 void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("intersect_point", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_intersect_point, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("intersect_ray", "parameters"), &PhysicsDirectSpaceState3D::_intersect_ray);
+	ClassDB::bind_method(D_METHOD("intersect_rays", "parameters", "from", "to"), &PhysicsDirectSpaceState3D::_intersect_rays);
 	ClassDB::bind_method(D_METHOD("intersect_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_intersect_shape, DEFVAL(32));
+	ClassDB::bind_method(D_METHOD("intersect_shapes", "parameters", "transforms", "max_results"), &PhysicsDirectSpaceState3D::_intersect_shapes, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState3D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "parameters"), &PhysicsDirectSpaceState3D::_get_rest_info);
@@ -1135,6 +1280,7 @@ PhysicsServer3D::PhysicsServer3D() {
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_separation", PROPERTY_HINT_RANGE, "0,0.1,0.001,or_greater"), 0.05);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_allowed_penetration", PROPERTY_HINT_RANGE, "0.001,0.1,0.001,or_greater"), 0.01);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/default_contact_bias", PROPERTY_HINT_RANGE, "0,1,0.01"), 0.8);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "physics/3d/solver/parallel_island_solve_threshold", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), 0);
 }
 
 PhysicsServer3D::~PhysicsServer3D() {
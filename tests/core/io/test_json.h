@@ -32,6 +32,8 @@
 #define TEST_JSON_H
 
 #include "core/io/json.h"
+#include "core/io/stream_peer.h"
+#include "core/os/os.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -232,6 +234,274 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 		ERR_PRINT_ON
 	}
 }
+
+// Builds the value starting at the current event of the reader.
+static Variant read_json_value(const Ref<JSONReader> &p_reader) {
+	switch (p_reader->get_event_type()) {
+		case JSONReader::EVENT_OBJECT_BEGIN: {
+			Dictionary object;
+			while (p_reader->read() == OK && p_reader->get_event_type() == JSONReader::EVENT_KEY) {
+				const String key = p_reader->get_value();
+				p_reader->read();
+				object[key] = read_json_value(p_reader);
+			}
+			return object;
+		}
+		case JSONReader::EVENT_ARRAY_BEGIN: {
+			Array array;
+			while (p_reader->read() == OK && p_reader->get_event_type() != JSONReader::EVENT_ARRAY_END) {
+				array.push_back(read_json_value(p_reader));
+			}
+			return array;
+		}
+		default:
+			return p_reader->get_value();
+	}
+}
+
+TEST_CASE("[JSONReader] Reading events") {
+	Ref<JSONReader> reader;
+	reader.instantiate();
+	reader->open_buffer(String(R"({"a": [1, true, null], "b": {"c": "d"}})").to_utf8_buffer());
+
+	const JSONReader::EventType events[] = {
+		JSONReader::EVENT_OBJECT_BEGIN,
+		JSONReader::EVENT_KEY,
+		JSONReader::EVENT_ARRAY_BEGIN,
+		JSONReader::EVENT_VALUE,
+		JSONReader::EVENT_VALUE,
+		JSONReader::EVENT_VALUE,
+		JSONReader::EVENT_ARRAY_END,
+		JSONReader::EVENT_KEY,
+		JSONReader::EVENT_OBJECT_BEGIN,
+		JSONReader::EVENT_KEY,
+		JSONReader::EVENT_VALUE,
+		JSONReader::EVENT_OBJECT_END,
+		JSONReader::EVENT_OBJECT_END,
+	};
+	const Variant values[] = { Variant(), "a", Variant(), 1.0, true, Variant(), Variant(), "b", Variant(), "c", "d", Variant(), Variant() };
+	const int depths[] = { 1, 1, 2, 2, 2, 2, 1, 1, 2, 2, 2, 1, 0 };
+
+	for (int i = 0; i < 13; i++) {
+		CHECK(reader->read() == OK);
+		CHECK_MESSAGE(reader->get_event_type() == events[i], vformat("Event %d should have the expected type.", i));
+		CHECK_MESSAGE(reader->get_value() == values[i], vformat("Event %d should have the expected value.", i));
+		CHECK_MESSAGE(reader->get_depth() == depths[i], vformat("Event %d should have the expected depth.", i));
+	}
+	CHECK(reader->read() == ERR_FILE_EOF);
+}
+
+TEST_CASE("[JSONReader] Reading documents larger than one chunk") {
+	// Strings, numbers and multi-byte characters end up split between chunks.
+	Array array;
+	for (int i = 0; i < 10000; i++) {
+		Dictionary entry;
+		entry["id"] = i;
+		entry["name"] = vformat(U"entry_%d_名前_🎤", i);
+		entry["value"] = i * 0.25;
+		array.push_back(entry);
+	}
+	const String text = JSON::stringify(array, "\t");
+
+	Ref<JSONReader> reader;
+	reader.instantiate();
+	reader->open_buffer(text.to_utf8_buffer());
+	REQUIRE(reader->read() == OK);
+
+	const Variant result = read_json_value(reader);
+	CHECK(reader->read() == ERR_FILE_EOF);
+	CHECK(reader->get_error_message().is_empty());
+	CHECK_MESSAGE(result == JSON::parse_string(text), "The events should describe the same data as the parsed JSON.");
+}
+
+// Stream which only has the data pushed to it so far.
+class JSONChunkedStream : public StreamPeer {
+	Vector<uint8_t> data;
+	int position = 0;
+
+public:
+	void push(const Vector<uint8_t> &p_bytes) { data.append_array(p_bytes); }
+
+	virtual Error put_data(const uint8_t *p_data, int p_bytes) override { return ERR_UNAVAILABLE; }
+	virtual Error put_partial_data(const uint8_t *p_data, int p_bytes, int &r_sent) override {
+		r_sent = 0;
+		return ERR_UNAVAILABLE;
+	}
+	virtual Error get_data(uint8_t *p_buffer, int p_bytes) override {
+		int received = 0;
+		get_partial_data(p_buffer, p_bytes, received);
+		return received == p_bytes ? OK : ERR_UNAVAILABLE;
+	}
+	virtual Error get_partial_data(uint8_t *p_buffer, int p_bytes, int &r_received) override {
+		r_received = MIN(p_bytes, data.size() - position);
+		memcpy(p_buffer, data.ptr() + position, r_received);
+		position += r_received;
+		return OK;
+	}
+	virtual int get_available_bytes() const override { return data.size() - position; }
+};
+
+TEST_CASE("[JSONReader] Reading values split between stream chunks") {
+	Ref<JSONChunkedStream> stream;
+	stream.instantiate();
+	Ref<JSONReader> reader;
+	reader.instantiate();
+	reader->open_stream(stream);
+
+	CHECK(reader->read() == ERR_BUSY);
+	stream->push(String("[1, 2").to_utf8_buffer());
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_event_type() == JSONReader::EVENT_ARRAY_BEGIN);
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_value() == Variant(1.0));
+	CHECK_MESSAGE(reader->read() == ERR_BUSY, "The number may continue in the next chunk.");
+	stream->push(String("3").to_utf8_buffer());
+	CHECK_MESSAGE(reader->read() == ERR_BUSY, "The number may still continue in the next chunk.");
+	stream->push(String("4, \"ab").to_utf8_buffer());
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_value() == Variant(234.0));
+
+	// Split a string in the middle of a multi-byte character.
+	const Vector<uint8_t> text = String(U"c名d\"]").to_utf8_buffer();
+	stream->push(text.slice(0, 2));
+	CHECK(reader->read() == ERR_BUSY);
+	stream->push(text.slice(2));
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_value() == Variant(U"abc名d"));
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_event_type() == JSONReader::EVENT_ARRAY_END);
+	CHECK_MESSAGE(reader->read() == ERR_BUSY, "The document is only complete once the stream ends.");
+	reader->end_stream();
+	CHECK(reader->read() == ERR_FILE_EOF);
+	CHECK(reader->get_error_message().is_empty());
+}
+
+TEST_CASE("[JSONReader] Reading a value at the end of a stream") {
+	Ref<StreamPeerBuffer> stream;
+	stream.instantiate();
+	stream->set_data_array(String("42").to_utf8_buffer());
+	Ref<JSONReader> reader;
+	reader.instantiate();
+	reader->open_stream(stream);
+
+	CHECK_MESSAGE(reader->read() == ERR_BUSY, "The number may continue until the stream ends.");
+	reader->end_stream();
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_value() == Variant(42.0));
+	CHECK(reader->read() == ERR_FILE_EOF);
+	CHECK(reader->get_error_message().is_empty());
+}
+
+TEST_CASE("[JSONReader] Reading from a file") {
+	const String path = OS::get_singleton()->get_cache_path().path_join("json_reader.json");
+
+	// Values are split between the chunks read from the file.
+	Array array;
+	for (int i = 0; i < 20000; i++) {
+		array.push_back(vformat("value_%d", i));
+		array.push_back(i * 1000003);
+	}
+	const String text = JSON::stringify(array);
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string(text);
+	}
+
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	Ref<JSONReader> reader;
+	reader.instantiate();
+	REQUIRE(reader->open_file(f) == OK);
+	REQUIRE(reader->read() == OK);
+
+	const Variant result = read_json_value(reader);
+	CHECK(reader->read() == ERR_FILE_EOF);
+	CHECK(reader->get_error_message().is_empty());
+	CHECK_MESSAGE(result == JSON::parse_string(text), "The events should describe the same data as the parsed JSON.");
+}
+
+TEST_CASE("[JSONReader] Reading invalid documents") {
+	ERR_PRINT_OFF
+	Ref<JSONReader> reader;
+	reader.instantiate();
+
+	reader->open_buffer(String("[1 2]").to_utf8_buffer());
+	CHECK(reader->read() == OK);
+	CHECK(reader->read() == OK);
+	CHECK(reader->read() == ERR_PARSE_ERROR);
+	CHECK(reader->get_error_message() == "Expected ','");
+
+	reader->open_buffer(String("{\n\"a\" 1}").to_utf8_buffer());
+	CHECK(reader->read() == OK);
+	CHECK(reader->read() == ERR_PARSE_ERROR);
+	CHECK(reader->get_error_message() == "Expected ':'");
+	CHECK(reader->get_error_line() == 1);
+
+	reader->open_buffer(String("[1] 2").to_utf8_buffer());
+	CHECK(reader->read() == OK);
+	CHECK(reader->read() == OK);
+	CHECK(reader->read() == OK);
+	CHECK(reader->read() == ERR_PARSE_ERROR);
+	CHECK(reader->get_error_message() == "Expected 'EOF'");
+	ERR_PRINT_ON
+}
+
+TEST_CASE("[JSONWriter] Writing documents") {
+	const String path = OS::get_singleton()->get_cache_path().path_join("json_writer.json");
+
+	Dictionary nested;
+	nested["x"] = 1;
+	nested["y"] = Array();
+
+	Ref<JSONWriter> writer;
+	writer.instantiate();
+	REQUIRE(writer->open(path, "\t") == OK);
+	writer->begin_object();
+	writer->write_key("array");
+	writer->begin_array();
+	writer->write_value(1);
+	writer->write_value("two");
+	writer->write_value(nested);
+	writer->end_array();
+	writer->write_key("empty");
+	writer->begin_array();
+	writer->end_array();
+	writer->end_object();
+	CHECK(writer->close() == OK);
+
+	Dictionary expected;
+	Array array;
+	array.push_back(1);
+	array.push_back("two");
+	array.push_back(nested);
+	expected["array"] = array;
+	expected["empty"] = Array();
+
+	CHECK_MESSAGE(
+			FileAccess::get_file_as_string(path) == JSON::stringify(expected, "\t"),
+			"The written JSON should match JSON.stringify().");
+
+	// Writing to an already opened file.
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string("// ");
+		REQUIRE(writer->open_file(f) == OK);
+		writer->write_value(expected);
+		CHECK(writer->close() == OK);
+	}
+	CHECK_MESSAGE(
+			FileAccess::get_file_as_string(path) == "// " + JSON::stringify(expected),
+			"The JSON should be written after the existing file contents.");
+
+	ERR_PRINT_OFF
+	REQUIRE(writer->open(path) == OK);
+	writer->begin_object();
+	CHECK_MESSAGE(writer->write_value(1) == ERR_INVALID_DATA, "Values in an object should require a key.");
+	CHECK_MESSAGE(writer->close() == ERR_INVALID_DATA, "Closing an incomplete document should fail.");
+	ERR_PRINT_ON
+}
 } // namespace TestJSON
 
 #endif // TEST_JSON_H
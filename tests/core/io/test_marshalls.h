@@ -386,6 +386,43 @@ TEST_CASE("[Marshalls] Typed array decoding") {
 	CHECK(array[0] == Variant(uint64_t(0x0f123456789abcdef)));
 }
 
+TEST_CASE("[Marshalls] Packed array round-trip") {
+	PackedByteArray bytes = { 0x00, 0x7f, 0x80, 0xff };
+	PackedInt32Array ints32 = { 0, -1, 0x12345678, INT32_MIN, INT32_MAX };
+	PackedInt64Array ints64 = { 0, -1, (int64_t)0x0f123456789abcdef, INT64_MIN, INT64_MAX };
+	PackedFloat32Array floats32 = { 0.0f, -1.5f, 3.25f, 1e30f };
+	PackedFloat64Array floats64 = { 0.0, -1.5, 3.25, 1e300 };
+	const Variant values[] = { bytes, ints32, ints64, floats32, floats64, PackedInt32Array() };
+
+	for (const Variant &value : values) {
+		int size;
+		REQUIRE(encode_variant(value, nullptr, size) == OK);
+
+		Vector<uint8_t> buffer;
+		buffer.resize(size);
+		int written;
+		CHECK(encode_variant(value, buffer.ptrw(), written) == OK);
+		CHECK(written == size);
+
+		Variant decoded;
+		int r_len;
+		CHECK(decode_variant(decoded, buffer.ptr(), buffer.size(), &r_len) == OK);
+		CHECK(r_len == size);
+		CHECK(decoded.get_type() == value.get_type());
+		CHECK(decoded == value);
+	}
+
+	// Little-endian layout of the elements.
+	uint8_t buffer[16];
+	int r_len;
+	CHECK(encode_variant(PackedInt32Array({ 0x12345678 }), buffer, r_len) == OK);
+	CHECK(r_len == 12);
+	CHECK(buffer[8] == 0x78);
+	CHECK(buffer[9] == 0x56);
+	CHECK(buffer[10] == 0x34);
+	CHECK(buffer[11] == 0x12);
+}
+
 } // namespace TestMarshalls
 
 #endif // TEST_MARSHALLS_H
@@ -0,0 +1,111 @@
+/**************************************************************************/
+/*  test_bvh.h                                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_BVH_H
+#define TEST_BVH_H
+
+#include "core/math/bvh.h"
+
+#include "tests/test_macros.h"
+
+namespace TestBVH {
+
+template <typename T>
+class PairTestFunction {
+public:
+	static bool user_pair_check(const T *p_a, const T *p_b) {
+		return true;
+	}
+};
+
+template <typename T>
+class CullTestFunction {
+public:
+	static bool user_cull_check(const T *p_a, const T *p_b) {
+		return true;
+	}
+};
+
+TEST_CASE("[BVH] Segment packets find the same items as single segments") {
+	BVH_Manager<int, 1, false, 32, PairTestFunction<int>, CullTestFunction<int>> bvh;
+
+	// A grid of boxes, with gaps between them.
+	const int grid_size = 8;
+	int items[grid_size * grid_size * grid_size];
+	for (int i = 0; i < grid_size * grid_size * grid_size; i++) {
+		items[i] = i;
+		const Vector3 position(i % grid_size, (i / grid_size) % grid_size, i / (grid_size * grid_size));
+		bvh.create(&items[i], true, 0, 1, AABB(position * 2.0, Vector3(1, 1, 1)));
+	}
+
+	// More segments than fit in one packet, fanning out from a shared origin.
+	const int segment_count = BVHCommon::SEGMENT_PACKET_SIZE + 8;
+	Vector3 from[segment_count];
+	Vector3 to[segment_count];
+	for (int i = 0; i < segment_count; i++) {
+		from[i] = Vector3(-1, 0.5, 0.5);
+		to[i] = Vector3(20, 0.5 + i * 0.4, 0.5 + (i % 7) * 2.0);
+	}
+
+	const int result_max = 4096;
+	int *packet_results[result_max];
+	int packet_segments[result_max];
+	const int packet_count = bvh.cull_segments(from, to, segment_count, packet_results, packet_segments, result_max, nullptr);
+	CHECK_MESSAGE(packet_count > 0, "The segments should hit some boxes.");
+
+	int *results[result_max];
+	int total_count = 0;
+	for (int i = 0; i < segment_count; i++) {
+		const int count = bvh.cull_segment(from[i], to[i], results, result_max, nullptr);
+		total_count += count;
+
+		HashSet<int> expected;
+		for (int j = 0; j < count; j++) {
+			expected.insert(*results[j]);
+		}
+
+		HashSet<int> found;
+		for (int j = 0; j < packet_count; j++) {
+			if (packet_segments[j] == i) {
+				found.insert(*packet_results[j]);
+			}
+		}
+
+		CHECK_MESSAGE(found.size() == expected.size(), vformat("Segment %d should hit the same number of boxes in a packet.", i));
+		for (const int &item : expected) {
+			CHECK_MESSAGE(found.has(item), vformat("Segment %d should hit box %d in a packet.", i, item));
+		}
+	}
+	CHECK(total_count == packet_count);
+}
+
+} // namespace TestBVH
+
+#endif // TEST_BVH_H
@@ -166,6 +166,27 @@ TEST_CASE("[String] UTF8 with CR") {
 	CHECK(no_cr == base.replace("\r", ""));
 }
 
+TEST_CASE("[String] UTF8 with long ASCII runs") {
+	// Long enough for the ASCII runs to be processed in blocks, with multi-byte characters and CR at various offsets.
+	const String base = U"The quick brown fox\r\njumps over the lazy dog. おまえはもう死んでいる, 🎤 and again: the quick brown fox jumps over\rthe lazy dog!";
+
+	const CharString utf8 = base.utf8();
+	String s;
+	Error err = s.parse_utf8(utf8.get_data(), utf8.length());
+	CHECK(err == OK);
+	CHECK(s == base);
+	CHECK(s.utf8() == utf8);
+
+	err = s.parse_utf8(utf8.get_data(), utf8.length(), true); // Skip CR.
+	CHECK(err == OK);
+	CHECK(s == base.replace("\r", ""));
+
+	// A length shorter than the data must stop in the middle of an ASCII run.
+	err = s.parse_utf8(utf8.get_data(), 13);
+	CHECK(err == OK);
+	CHECK(s == "The quick bro");
+}
+
 TEST_CASE("[String] Invalid UTF8 (non-standard)") {
 	ERR_PRINT_OFF
 	static const uint8_t u8str[] = { 0x45, 0xE3, 0x81, 0x8A, 0xE3, 0x82, 0x88, 0xE3, 0x81, 0x86, 0xF0, 0x9F, 0x8E, 0xA4, 0xF0, 0x82, 0x82, 0xAC, 0xED, 0xA0, 0x81, 0 };
@@ -320,6 +341,10 @@ TEST_CASE("[String] Case function test") {
 
 	CHECK(a.to_upper() == "MOMONGA");
 	CHECK(a.to_lower() == "momonga");
+
+	String b = U"Ünïcode @[`{ MiXeD";
+	CHECK(b.to_upper() == U"ÜNÏCODE @[`{ MIXED");
+	CHECK(b.to_lower() == U"ünïcode @[`{ mixed");
 }
 
 TEST_CASE("[String] Case compare function test") {
@@ -0,0 +1,83 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STRING_NAME_H
+#define TEST_STRING_NAME_H
+
+#include "core/object/worker_thread_pool.h"
+#include "core/string/string_name.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Construction and search") {
+	const StringName name = "test_string_name_construction";
+	CHECK(name == StringName(String("test_string_name_construction")));
+	CHECK(name == StringName::search("test_string_name_construction"));
+	CHECK(name == StringName::search(String("test_string_name_construction")));
+	CHECK(StringName::search("test_string_name_never_created") == StringName());
+}
+
+static const int THREAD_NAME_COUNT = 256;
+static const int THREAD_TASK_COUNT = 64;
+
+static StringName thread_names[THREAD_TASK_COUNT][THREAD_NAME_COUNT];
+
+static void thread_create_names(void *p_userdata, uint32_t p_index) {
+	// Every task interns the same names, mixing existing and new ones.
+	for (int i = 0; i < THREAD_NAME_COUNT; i++) {
+		thread_names[p_index][i] = StringName(vformat("test_string_name_thread_%d", (i + p_index) % THREAD_NAME_COUNT));
+	}
+}
+
+TEST_CASE("[StringName] Interning from many threads") {
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(thread_create_names, nullptr, THREAD_TASK_COUNT, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	bool all_unique = true;
+	for (int i = 0; i < THREAD_TASK_COUNT; i++) {
+		for (int j = 0; j < THREAD_NAME_COUNT; j++) {
+			const StringName &name = thread_names[i][(j + THREAD_NAME_COUNT - i) % THREAD_NAME_COUNT];
+			all_unique &= name.data_unique_pointer() == thread_names[0][j].data_unique_pointer();
+		}
+	}
+	CHECK_MESSAGE(all_unique, "Every thread should get the same StringName for the same string.");
+
+	for (int i = 0; i < THREAD_TASK_COUNT; i++) {
+		for (int j = 0; j < THREAD_NAME_COUNT; j++) {
+			thread_names[i][j] = StringName();
+		}
+	}
+}
+
+} // namespace TestStringName
+
+#endif // TEST_STRING_NAME_H
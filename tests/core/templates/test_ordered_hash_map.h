@@ -0,0 +1,184 @@
+/**************************************************************************/
+/*  test_ordered_hash_map.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_ORDERED_HASH_MAP_H
+#define TEST_ORDERED_HASH_MAP_H
+
+#include "core/templates/ordered_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestOrderedHashMap {
+
+TEST_CASE("[OrderedHashMap] Insert element") {
+	OrderedHashMap<int, int> map;
+	OrderedHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+}
+
+TEST_CASE("[OrderedHashMap] Overwrite element") {
+	OrderedHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map[42] == 1234);
+	CHECK(map.size() == 1);
+}
+
+TEST_CASE("[OrderedHashMap] Erase via element") {
+	OrderedHashMap<int, int> map;
+	OrderedHashMap<int, int>::Iterator e = map.insert(42, 84);
+	map.remove(e);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[OrderedHashMap] Erase via key") {
+	OrderedHashMap<int, int> map;
+	map.insert(42, 84);
+	CHECK(map.erase(42));
+	CHECK(!map.erase(42));
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+}
+
+TEST_CASE("[OrderedHashMap] Iteration keeps insertion order") {
+	OrderedHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	map.insert(0, 12934);
+	map.insert(123485, 1238888);
+	map.insert(123, 111111);
+
+	const OrderedHashMap<int, int> const_map = map;
+
+	Vector<Pair<int, int>> expected;
+	expected.push_back(Pair<int, int>(42, 84));
+	expected.push_back(Pair<int, int>(123, 111111));
+	expected.push_back(Pair<int, int>(0, 12934));
+	expected.push_back(Pair<int, int>(123485, 1238888));
+
+	int idx = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(expected[idx] == Pair<int, int>(E.key, E.value));
+		++idx;
+	}
+	CHECK(idx == expected.size());
+
+	idx = 0;
+	for (const KeyValue<int, int> &E : const_map) {
+		CHECK(expected[idx] == Pair<int, int>(E.key, E.value));
+		++idx;
+	}
+	CHECK(idx == expected.size());
+
+	idx = expected.size() - 1;
+	for (OrderedHashMap<int, int>::Iterator E = map.last(); E; --E) {
+		CHECK(expected[idx] == Pair<int, int>(E->key, E->value));
+		--idx;
+	}
+	CHECK(idx == -1);
+}
+
+TEST_CASE("[OrderedHashMap] Erase keeps the order of remaining elements") {
+	OrderedHashMap<int, int> map;
+	for (int i = 0; i < 1000; i++) {
+		map.insert(i, i * 2);
+	}
+
+	int *last = map.getptr(999);
+	for (int i = 0; i < 1000; i++) {
+		if (i % 3 != 0) {
+			CHECK(map.erase(i));
+		}
+	}
+	CHECK(map.size() == 334);
+	CHECK_MESSAGE(last == map.getptr(999), "Erasing should not move the remaining elements.");
+
+	int expected = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key == expected);
+		CHECK(E.value == expected * 2);
+		expected += 3;
+	}
+	CHECK(expected == 1002);
+
+	for (int i = 0; i < 1000; i++) {
+		CHECK(map.has(i) == (i % 3 == 0));
+	}
+
+	// Elements inserted after erasing go to the end, the erased ones are compacted away first.
+	map.insert(1, 1);
+	CHECK(map.last()->key == 1);
+	CHECK(map.begin()->key == 0);
+	expected = 0;
+	for (const KeyValue<int, int> &E : map) {
+		if (E.key == 1) {
+			break;
+		}
+		CHECK(E.key == expected);
+		expected += 3;
+	}
+	CHECK(expected == 1002);
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(map.begin() == map.end());
+	map.insert(5, 5);
+	CHECK(map.begin()->key == 5);
+}
+
+TEST_CASE("[OrderedHashMap] Pointers stay valid across insertions") {
+	OrderedHashMap<String, int> map;
+	map.insert("first", 1);
+	int *first = map.getptr("first");
+	OrderedHashMap<String, int>::Iterator it = map.find("first");
+
+	for (int i = 0; i < 10000; i++) {
+		map.insert(itos(i), i);
+	}
+
+	CHECK(first == map.getptr("first"));
+	CHECK(*first == 1);
+	CHECK(it->key == "first");
+	CHECK(map.size() == 10001);
+	CHECK(map[itos(9999)] == 9999);
+}
+
+} // namespace TestOrderedHashMap
+
+#endif // TEST_ORDERED_HASH_MAP_H
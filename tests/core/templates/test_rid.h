@@ -31,7 +31,9 @@
 #ifndef TEST_RID_H
 #define TEST_RID_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/rid.h"
+#include "core/templates/rid_owner.h"
 
 #include "tests/test_macros.h"
 
@@ -96,6 +98,81 @@ TEST_CASE("[RID] 'get_local_index'") {
 	CHECK(RID::from_uint64(4'294'967'295).get_local_index() == 4'294'967'295);
 	CHECK(RID::from_uint64(4'294'967'297).get_local_index() == 1);
 }
+
+static const int THREAD_RID_COUNT = 1024;
+static const int THREAD_TASK_COUNT = 32;
+
+struct RIDThreadTest {
+	RID_Owner<uint64_t, true> owner;
+	RID rids[THREAD_TASK_COUNT][THREAD_RID_COUNT];
+	SafeNumeric<uint32_t> errors;
+
+	void process(uint32_t p_index, void *p_userdata) {
+		RID *task_rids = rids[p_index];
+		for (int i = 0; i < THREAD_RID_COUNT; i++) {
+			task_rids[i] = owner.make_rid(((uint64_t)p_index << 32) | i);
+		}
+		// Free half of them while the other tasks keep allocating, then look up the rest.
+		for (int i = 0; i < THREAD_RID_COUNT; i += 2) {
+			owner.free(task_rids[i]);
+		}
+		for (int i = 0; i < THREAD_RID_COUNT; i++) {
+			uint64_t *value = owner.get_or_null(task_rids[i]);
+			bool expected = i % 2 == 1;
+			if ((value != nullptr) != expected || (value && *value != (((uint64_t)p_index << 32) | i))) {
+				errors.increment();
+			}
+		}
+	}
+};
+
+TEST_CASE("[RID_Owner] Allocate, look up and free from many threads") {
+	RIDThreadTest *test = memnew(RIDThreadTest);
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(test, &RIDThreadTest::process, nullptr, THREAD_TASK_COUNT, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK_MESSAGE(test->errors.get() == 0, "Every thread should only find its own live RIDs.");
+	CHECK(test->owner.get_rid_count() == THREAD_TASK_COUNT * THREAD_RID_COUNT / 2);
+
+	for (int i = 0; i < THREAD_TASK_COUNT; i++) {
+		for (int j = 1; j < THREAD_RID_COUNT; j += 2) {
+			CHECK(test->owner.owns(test->rids[i][j]));
+			test->owner.free(test->rids[i][j]);
+		}
+	}
+	CHECK(test->owner.get_rid_count() == 0);
+
+	memdelete(test);
+}
+
+struct RIDFreeTest;
+static RID_Owner<RIDFreeTest, true> *free_test_owner = nullptr;
+
+struct RIDFreeTest {
+	RID self;
+	bool *r_found = nullptr;
+
+	~RIDFreeTest() {
+		if (r_found) {
+			*r_found = free_test_owner->get_or_null(self) != nullptr;
+		}
+	}
+};
+
+TEST_CASE("[RID_Owner] Lookups fail once an object is being freed") {
+	RID_Owner<RIDFreeTest, true> owner;
+	free_test_owner = &owner;
+
+	bool found = true;
+	RID rid = owner.make_rid();
+	owner.get_or_null(rid)->self = rid;
+	owner.get_or_null(rid)->r_found = &found;
+	owner.free(rid);
+
+	CHECK_MESSAGE(!found, "The RID should be invalid before its object is destroyed.");
+	free_test_owner = nullptr;
+}
 } // namespace TestRID
 
 #endif // TEST_RID_H
@@ -31,6 +31,8 @@
 #ifndef TEST_WORKER_THREAD_POOL_H
 #define TEST_WORKER_THREAD_POOL_H
 
+#include "core/io/file_access.h"
+#include "core/io/json.h"
 #include "core/object/worker_thread_pool.h"
 
 #include "tests/test_macros.h"
@@ -107,6 +109,56 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+static void static_dependency_test(void *p_arg) {
+	// Records the order in which the tasks ran.
+	counter[(uint64_t)p_arg].set(counter[0].increment());
+}
+TEST_CASE("[WorkerThreadPool] Run tasks only once their dependencies are completed") {
+	for (int iterations = 0; iterations < 500; iterations++) {
+		const bool low_priority = Math::rand() % 2;
+
+		counter.clear();
+		counter.resize(5);
+
+		WorkerThreadPool::TaskID dependencies[2];
+		dependencies[0] = WorkerThreadPool::get_singleton()->add_native_task(static_dependency_test, (void *)1, !low_priority);
+		dependencies[1] = WorkerThreadPool::get_singleton()->add_native_task(static_dependency_test, (void *)2, low_priority);
+		WorkerThreadPool::TaskID dependent = WorkerThreadPool::get_singleton()->add_native_task_with_dependencies(static_dependency_test, (void *)3, dependencies, 2, low_priority);
+		WorkerThreadPool::TaskID continuation = WorkerThreadPool::get_singleton()->add_native_task_with_dependencies(static_dependency_test, (void *)4, &dependent, 1, !low_priority);
+
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(continuation);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(dependent);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(dependencies[0]);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(dependencies[1]);
+
+		CHECK(counter[3].get() > counter[1].get());
+		CHECK(counter[3].get() > counter[2].get());
+		CHECK(counter[4].get() == 4);
+	}
+}
+
+static void static_group_dependency_test(void *p_arg, uint32_t p_index) {
+	counter[1].increment();
+}
+static void static_group_dependent_test(void *p_arg) {
+	*((bool *)p_arg) = counter[1].get() == 64;
+}
+TEST_CASE("[WorkerThreadPool] Run tasks only once their group dependencies are completed") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		counter.clear();
+		counter.resize(2);
+
+		bool group_completed = false;
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_group_dependency_test, nullptr, 64, -1, true);
+		WorkerThreadPool::TaskID dependent = WorkerThreadPool::get_singleton()->add_native_task_with_dependencies(static_group_dependent_test, &group_completed, &group, 1, true);
+
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(dependent);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+		CHECK(group_completed);
+	}
+}
+
 static void static_test_daemon(void *p_arg) {
 	while (!exit.is_set()) {
 		counter[0].add(1);
@@ -173,6 +225,93 @@ TEST_CASE("[WorkerThreadPool] Run a yielding daemon as the only hope for other t
 	CHECK_MESSAGE(all_needed_yield, "All legit tasks should have needed the daemon yielding to run.");
 }
 
+static void static_trace_test(void *p_arg) {
+	OS::get_singleton()->delay_usec(100);
+}
+
+static void static_trace_group_test(void *p_arg, uint32_t p_index) {
+	OS::get_singleton()->delay_usec(10);
+}
+
+TEST_CASE("[WorkerThreadPool] Record a trace of the tasks") {
+	const String path = OS::get_singleton()->get_cache_path().path_join("worker_thread_pool_trace.json");
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	pool->set_tracing_enabled(true);
+
+	const int task_count = 16;
+	LocalVector<WorkerThreadPool::TaskID> task_ids;
+	for (int i = 0; i < task_count; i++) {
+		task_ids.push_back(pool->add_native_task(static_trace_test, nullptr, true, vformat("Traced \"task\" %d", i)));
+	}
+	// Saving while the tasks run must not disturb them.
+	CHECK(pool->save_trace(path) == OK);
+	CHECK(JSON::parse_string(FileAccess::get_file_as_string(path)).get_type() == Variant::DICTIONARY);
+
+	WorkerThreadPool::GroupID group_id = pool->add_native_group_task(static_trace_group_test, nullptr, 64, 2, true, "Traced group");
+	for (WorkerThreadPool::TaskID task_id : task_ids) {
+		pool->wait_for_task_completion(task_id);
+	}
+	pool->wait_for_group_task_completion(group_id);
+	pool->trace_frame();
+	pool->set_tracing_enabled(false);
+	pool->trace_frame();
+	REQUIRE(pool->save_trace(path) == OK);
+
+	const Variant trace = JSON::parse_string(FileAccess::get_file_as_string(path));
+	REQUIRE(trace.get_type() == Variant::DICTIONARY);
+	const Array events = Dictionary(trace)["traceEvents"];
+
+	int traced_tasks = 0;
+	int traced_groups = 0;
+	int frames = 0;
+	HashMap<int, LocalVector<Pair<int64_t, int64_t>>> thread_spans;
+	for (const Variant &event_variant : events) {
+		const Dictionary event = event_variant;
+		const String phase = event["ph"];
+		if (phase == "i") {
+			frames++;
+			continue;
+		}
+		if (phase != "X") {
+			continue;
+		}
+		const int64_t begin = event["ts"];
+		const int64_t duration = event["dur"];
+		CHECK_MESSAGE(duration >= 0, "Tasks should end after they begin.");
+		thread_spans[event["tid"]].push_back(Pair<int64_t, int64_t>(begin, begin + duration));
+		if (event["cat"] == "group") {
+			CHECK(event["name"] == "Traced group");
+			traced_groups++;
+		} else {
+			CHECK(String(event["name"]).begins_with("Traced \"task\" "));
+			traced_tasks++;
+		}
+	}
+	CHECK(frames == 1);
+	CHECK_MESSAGE(traced_tasks == task_count, "Tasks should be traced before they are reported as completed.");
+	CHECK(traced_groups >= 1);
+	CHECK(traced_groups <= 2);
+
+	// A thread runs its tasks one after the other, unless it runs another task while it waits.
+	bool spans_nested = true;
+	bool spans_sorted = true;
+	for (const KeyValue<int, LocalVector<Pair<int64_t, int64_t>>> &E : thread_spans) {
+		for (uint32_t i = 0; i < E.value.size(); i++) {
+			spans_sorted &= i == 0 || E.value[i - 1].first <= E.value[i].first;
+			for (uint32_t j = i + 1; j < E.value.size(); j++) {
+				const Pair<int64_t, int64_t> &a = E.value[i];
+				const Pair<int64_t, int64_t> &b = E.value[j];
+				const bool disjoint = a.second <= b.first || b.second <= a.first;
+				const bool nested = (a.first <= b.first && b.second <= a.second) || (b.first <= a.first && a.second <= b.second);
+				spans_nested &= disjoint || nested;
+			}
+		}
+	}
+	CHECK_MESSAGE(spans_nested, "The events of each thread should be properly nested.");
+	CHECK_MESSAGE(spans_sorted, "The events of each thread should be written in timestamp order.");
+}
+
 } // namespace TestWorkerThreadPool
 
 #endif // TEST_WORKER_THREAD_POOL_H
@@ -745,6 +745,61 @@ TEST_SUITE("[Navigation]") {
 			CHECK_EQ(query_result->get_path_owner_ids().size(), 0);
 		}
 
+		SUBCASE("Batched queries should call back with a result per query") {
+			Ref<NavigationPathQueryParameters3D> query_parameters_1 = memnew(NavigationPathQueryParameters3D);
+			query_parameters_1->set_map(map);
+			query_parameters_1->set_start_position(Vector3(0, 0, 0));
+			query_parameters_1->set_target_position(Vector3(10, 0, 10));
+			Ref<NavigationPathQueryParameters3D> query_parameters_2 = memnew(NavigationPathQueryParameters3D);
+			query_parameters_2->set_map(map);
+			query_parameters_2->set_start_position(Vector3(10, 0, 10));
+			query_parameters_2->set_target_position(Vector3(0, 0, 0));
+			query_parameters_2->set_navigation_layers(2);
+			TypedArray<NavigationPathQueryParameters3D> query_parameters;
+			query_parameters.push_back(query_parameters_1);
+			query_parameters.push_back(query_parameters_2);
+
+			CallableMock callback_mock;
+			navigation_server->query_path_batch(query_parameters, callable_mp(&callback_mock, &CallableMock::function1));
+			CHECK_EQ(callback_mock.function1_calls, 0);
+			navigation_server->process(0.0); // Start the queries after synchronization.
+			CHECK_EQ(callback_mock.function1_calls, 0);
+			navigation_server->process(0.0); // Deliver the results.
+			CHECK_EQ(callback_mock.function1_calls, 1);
+
+			const Array results = callback_mock.function1_latest_arg0;
+			REQUIRE_EQ(results.size(), 2);
+			const Ref<NavigationPathQueryResult3D> query_result_1 = results[0];
+			const Ref<NavigationPathQueryResult3D> query_result_2 = results[1];
+			REQUIRE(query_result_1.is_valid());
+			REQUIRE(query_result_2.is_valid());
+			CHECK_NE(query_result_1->get_path().size(), 0);
+			CHECK_EQ(query_result_2->get_path().size(), 0);
+		}
+
+		SUBCASE("Batched queries should call back while the server is inactive") {
+			Ref<NavigationPathQueryParameters3D> query_parameters_1 = memnew(NavigationPathQueryParameters3D);
+			query_parameters_1->set_map(map);
+			query_parameters_1->set_start_position(Vector3(0, 0, 0));
+			query_parameters_1->set_target_position(Vector3(10, 0, 10));
+			TypedArray<NavigationPathQueryParameters3D> query_parameters;
+			query_parameters.push_back(query_parameters_1);
+
+			navigation_server->set_active(false);
+			CallableMock callback_mock;
+			navigation_server->query_path_batch(query_parameters, callable_mp(&callback_mock, &CallableMock::function1));
+			navigation_server->process(0.0);
+			navigation_server->process(0.0);
+			navigation_server->set_active(true);
+			CHECK_EQ(callback_mock.function1_calls, 1);
+
+			const Array results = callback_mock.function1_latest_arg0;
+			REQUIRE_EQ(results.size(), 1);
+			const Ref<NavigationPathQueryResult3D> query_result_1 = results[0];
+			REQUIRE(query_result_1.is_valid());
+			CHECK_NE(query_result_1->get_path().size(), 0);
+		}
+
 		SUBCASE("Elaborate query without metadata flags should yield path only") {
 			Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
 			query_parameters->set_map(map);
@@ -764,6 +819,410 @@ TEST_SUITE("[Navigation]") {
 		navigation_server->process(0.0); // Give server some cycles to commit.
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should respond to queries against map with many polygons properly") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+
+		// Flat grid of 16x16 unit quads, enough polygons to exercise the map spatial index.
+		const int grid_size = 16;
+		Vector<Vector3> vertices;
+		for (int z = 0; z <= grid_size; z++) {
+			for (int x = 0; x <= grid_size; x++) {
+				vertices.push_back(Vector3(x, 0, z));
+			}
+		}
+		navigation_mesh->set_vertices(vertices);
+		for (int z = 0; z < grid_size; z++) {
+			for (int x = 0; x < grid_size; x++) {
+				const int i = z * (grid_size + 1) + x;
+				Vector<int> polygon;
+				polygon.push_back(i);
+				polygon.push_back(i + 1);
+				polygon.push_back(i + grid_size + 2);
+				polygon.push_back(i + grid_size + 1);
+				navigation_mesh->add_polygon(polygon);
+			}
+		}
+		CHECK_EQ(navigation_mesh->get_polygon_count(), grid_size * grid_size);
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		SUBCASE("Closest point queries should return the point on the nearest polygon") {
+			CHECK(navigation_server->map_get_closest_point(map, Vector3(3.5, 2.0, 7.25)).is_equal_approx(Vector3(3.5, 0.0, 7.25)));
+			CHECK(navigation_server->map_get_closest_point(map, Vector3(-4.0, 0.0, 8.5)).is_equal_approx(Vector3(0.0, 0.0, 8.5)));
+			CHECK(navigation_server->map_get_closest_point(map, Vector3(20.0, -1.0, 20.0)).is_equal_approx(Vector3(16.0, 0.0, 16.0)));
+			CHECK_EQ(navigation_server->map_get_closest_point_owner(map, Vector3(12.5, 1.0, 0.5)), region);
+		}
+
+		SUBCASE("Closest point to segment queries should return the nearest intersection or edge point") {
+			CHECK(navigation_server->map_get_closest_point_to_segment(map, Vector3(5.5, 1.0, 5.5), Vector3(5.5, -1.0, 5.5), true).is_equal_approx(Vector3(5.5, 0.0, 5.5)));
+			CHECK(navigation_server->map_get_closest_point_to_segment(map, Vector3(9.25, 1.0, 2.5), Vector3(9.25, -1.0, 2.5), false).is_equal_approx(Vector3(9.25, 0.0, 2.5)));
+			CHECK(navigation_server->map_get_closest_point_to_segment(map, Vector3(-2.0, 0.0, 3.0), Vector3(-1.0, 0.0, 3.0), false).is_equal_approx(Vector3(0.0, 0.0, 3.0)));
+		}
+
+		SUBCASE("Path queries should start and end on the closest polygons") {
+			const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(0.5, 1.0, 0.5), Vector3(15.5, 1.0, 15.5), true);
+			REQUIRE_GE(path.size(), 2);
+			CHECK(path[0].is_equal_approx(Vector3(0.5, 0.0, 0.5)));
+			CHECK(path[path.size() - 1].is_equal_approx(Vector3(15.5, 0.0, 15.5)));
+		}
+
+		SUBCASE("Hierarchical path queries should find the same path across regions") {
+			RID other_region = navigation_server->region_create();
+			navigation_server->region_set_map(other_region, map);
+			navigation_server->region_set_transform(other_region, Transform3D(Basis(), Vector3(grid_size, 0, 0)));
+			navigation_server->region_set_navigation_mesh(other_region, navigation_mesh);
+			navigation_server->process(0.0); // Give server some cycles to commit.
+
+			Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
+			query_parameters->set_map(map);
+			query_parameters->set_start_position(Vector3(0.5, 0.0, 0.5));
+			query_parameters->set_target_position(Vector3(31.5, 0.0, 15.5));
+			Ref<NavigationPathQueryResult3D> query_result = memnew(NavigationPathQueryResult3D);
+			navigation_server->query_path(query_parameters, query_result);
+			const Vector<Vector3> path = query_result->get_path();
+			CHECK_GT(query_result->get_expanded_polygon_count(), 0);
+
+			navigation_server->map_set_use_hierarchical_pathfinding(map, true);
+			CHECK(navigation_server->map_get_use_hierarchical_pathfinding(map));
+			navigation_server->process(0.0); // Give server some cycles to commit.
+			navigation_server->query_path(query_parameters, query_result);
+			CHECK_EQ(query_result->get_path(), path);
+			CHECK_GT(query_result->get_expanded_polygon_count(), 0);
+
+			navigation_server->free(other_region);
+		}
+
+		SUBCASE("Hierarchical path queries should expand fewer polygons than flat queries") {
+			// The start region is next to a dead end region towards the target, the path has to go around it.
+			// Region offsets of one unit leave gaps wider than the edge connection margin.
+			const Vector3 region_offsets[] = {
+				Vector3(grid_size, 0, 0), // Dead end.
+				Vector3(0, 0, grid_size),
+				Vector3(grid_size, 0, grid_size + 1),
+				Vector3(grid_size * 2, 0, grid_size + 1),
+				Vector3(grid_size * 2 + 1, 0, 1), // Target.
+			};
+			LocalVector<RID> other_regions;
+			for (const Vector3 &region_offset : region_offsets) {
+				RID other_region = navigation_server->region_create();
+				navigation_server->region_set_map(other_region, map);
+				navigation_server->region_set_transform(other_region, Transform3D(Basis(), region_offset));
+				navigation_server->region_set_navigation_mesh(other_region, navigation_mesh);
+				other_regions.push_back(other_region);
+			}
+			navigation_server->process(0.0); // Give server some cycles to commit.
+
+			Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
+			query_parameters->set_map(map);
+			query_parameters->set_start_position(Vector3(8.5, 0.0, 8.5));
+			query_parameters->set_target_position(Vector3(40.5, 0.0, 8.5));
+			Ref<NavigationPathQueryResult3D> flat_query_result = memnew(NavigationPathQueryResult3D);
+			navigation_server->query_path(query_parameters, flat_query_result);
+			REQUIRE_GE(flat_query_result->get_path().size(), 2);
+			CHECK(flat_query_result->get_path()[flat_query_result->get_path().size() - 1].is_equal_approx(Vector3(40.5, 0.0, 8.5)));
+
+			navigation_server->map_set_use_hierarchical_pathfinding(map, true);
+			navigation_server->process(0.0); // Give server some cycles to commit.
+			Ref<NavigationPathQueryResult3D> hierarchical_query_result = memnew(NavigationPathQueryResult3D);
+			navigation_server->query_path(query_parameters, hierarchical_query_result);
+			REQUIRE_GE(hierarchical_query_result->get_path().size(), 2);
+			CHECK(hierarchical_query_result->get_path()[hierarchical_query_result->get_path().size() - 1].is_equal_approx(Vector3(40.5, 0.0, 8.5)));
+			CHECK_GT(hierarchical_query_result->get_expanded_polygon_count(), 0);
+			CHECK_LT(hierarchical_query_result->get_expanded_polygon_count(), flat_query_result->get_expanded_polygon_count());
+
+			navigation_server->map_set_use_hierarchical_pathfinding(map, false);
+			for (const RID &other_region : other_regions) {
+				navigation_server->free(other_region);
+			}
+		}
+
+		SUBCASE("Hierarchical path queries on a single region should search the whole region") {
+			Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
+			query_parameters->set_map(map);
+			query_parameters->set_start_position(Vector3(0.5, 0.0, 0.5));
+			query_parameters->set_target_position(Vector3(15.5, 0.0, 15.5));
+			Ref<NavigationPathQueryResult3D> flat_query_result = memnew(NavigationPathQueryResult3D);
+			navigation_server->query_path(query_parameters, flat_query_result);
+
+			navigation_server->map_set_use_hierarchical_pathfinding(map, true);
+			navigation_server->process(0.0); // Give server some cycles to commit.
+			Ref<NavigationPathQueryResult3D> hierarchical_query_result = memnew(NavigationPathQueryResult3D);
+			navigation_server->query_path(query_parameters, hierarchical_query_result);
+			CHECK_EQ(hierarchical_query_result->get_path(), flat_query_result->get_path());
+			CHECK_EQ(hierarchical_query_result->get_expanded_polygon_count(), flat_query_result->get_expanded_polygon_count());
+
+			navigation_server->map_set_use_hierarchical_pathfinding(map, false);
+		}
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should update maps incrementally like a full rebuild") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+
+		// Flat tile of 4x4 unit quads.
+		const int tile_size = 4;
+		Vector<Vector3> vertices;
+		for (int z = 0; z <= tile_size; z++) {
+			for (int x = 0; x <= tile_size; x++) {
+				vertices.push_back(Vector3(x, 0, z));
+			}
+		}
+		navigation_mesh->set_vertices(vertices);
+		for (int z = 0; z < tile_size; z++) {
+			for (int x = 0; x < tile_size; x++) {
+				const int i = z * (tile_size + 1) + x;
+				Vector<int> polygon;
+				polygon.push_back(i);
+				polygon.push_back(i + 1);
+				polygon.push_back(i + tile_size + 2);
+				polygon.push_back(i + tile_size + 1);
+				navigation_mesh->add_polygon(polygon);
+			}
+		}
+
+		// The first two tiles share their edges, the last one is connected across a small gap.
+		const Vector3 tile_offsets[3] = { Vector3(0, 0, 0), Vector3(tile_size, 0, 0), Vector3(2 * tile_size + 0.1, 0, 0) };
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		RID regions[3];
+		for (int i = 0; i < 3; i++) {
+			regions[i] = navigation_server->region_create();
+			navigation_server->region_set_map(regions[i], map);
+			navigation_server->region_set_transform(regions[i], Transform3D(Basis(), tile_offsets[i]));
+			navigation_server->region_set_navigation_mesh(regions[i], navigation_mesh);
+		}
+		RID link = navigation_server->link_create();
+		navigation_server->link_set_map(link, map);
+		navigation_server->link_set_start_position(link, Vector3(1.5, 0, 3.5));
+		navigation_server->link_set_end_position(link, Vector3(10.5, 0, 0.5));
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		// Remove, disable and add back regions so the map is only partially updated on each sync.
+		navigation_server->region_set_map(regions[1], RID());
+		navigation_server->process(0.0); // Give server some cycles to commit.
+		navigation_server->region_set_enabled(regions[2], false);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+		navigation_server->region_set_enabled(regions[2], true);
+		navigation_server->region_set_map(regions[1], map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		// Build the same map from scratch, with the regions in the same order.
+		RID rebuilt_map = navigation_server->map_create();
+		navigation_server->map_set_active(rebuilt_map, true);
+		RID rebuilt_regions[3];
+		const int rebuilt_order[3] = { 0, 2, 1 };
+		for (int i : rebuilt_order) {
+			rebuilt_regions[i] = navigation_server->region_create();
+			navigation_server->region_set_map(rebuilt_regions[i], rebuilt_map);
+			navigation_server->region_set_transform(rebuilt_regions[i], Transform3D(Basis(), tile_offsets[i]));
+			navigation_server->region_set_navigation_mesh(rebuilt_regions[i], navigation_mesh);
+		}
+		RID rebuilt_link = navigation_server->link_create();
+		navigation_server->link_set_map(rebuilt_link, rebuilt_map);
+		navigation_server->link_set_start_position(rebuilt_link, Vector3(1.5, 0, 3.5));
+		navigation_server->link_set_end_position(rebuilt_link, Vector3(10.5, 0, 0.5));
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		for (int i = 0; i < 3; i++) {
+			CHECK_EQ(navigation_server->region_get_connections_count(regions[i]), navigation_server->region_get_connections_count(rebuilt_regions[i]));
+		}
+		const Vector3 positions[4] = { Vector3(0.5, 0, 0.5), Vector3(1.5, 0, 3.25), Vector3(7.75, 0, 2.5), Vector3(11.5, 0, 3.5) };
+		for (const Vector3 &from : positions) {
+			for (const Vector3 &to : positions) {
+				CHECK_EQ(navigation_server->map_get_path(map, from, to, true), navigation_server->map_get_path(rebuilt_map, from, to, true));
+			}
+			CHECK_EQ(navigation_server->map_get_closest_point(map, from + Vector3(0, 1, 0)), navigation_server->map_get_closest_point(rebuilt_map, from + Vector3(0, 1, 0)));
+		}
+		const Vector<Vector3> path = navigation_server->map_get_path(map, positions[0], positions[3], true);
+		REQUIRE_GE(path.size(), 2);
+		CHECK(path[path.size() - 1].is_equal_approx(positions[3]));
+
+		navigation_server->free(rebuilt_link);
+		navigation_server->free(link);
+		for (int i = 0; i < 3; i++) {
+			navigation_server->free(rebuilt_regions[i]);
+			navigation_server->free(regions[i]);
+		}
+		navigation_server->free(rebuilt_map);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should bake tiled navigation meshes") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(10.0, 0.001, 10.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		navigation_mesh->set_tile_size(4.0);
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+		CHECK_NE(navigation_mesh->get_vertices().size(), 0);
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		SUBCASE("Tiles should be connected to each other") {
+			const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-4.0, 0.0, -4.0), Vector3(4.0, 0.0, 4.0), true);
+			CHECK_NE(path.size(), 0);
+			CHECK(path[path.size() - 1].is_equal_approx(navigation_server->map_get_closest_point(map, Vector3(4.0, 0.0, 4.0))));
+		}
+
+		SUBCASE("Rebaking a dirty area should keep the other tiles") {
+			const int polygon_count = navigation_mesh->get_polygon_count();
+			navigation_server->bake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, AABB(Vector3(-1.0, -1.0, -1.0), Vector3(2.0, 2.0, 2.0)));
+			CHECK_EQ(navigation_mesh->get_polygon_count(), polygon_count);
+		}
+
+		SUBCASE("Tile vertices should stay within the source geometry") {
+			const real_t epsilon = navigation_mesh->get_cell_size();
+			for (const Vector3 &vertex : navigation_mesh->get_vertices()) {
+				CHECK_GE(vertex.x, -5.0 - epsilon);
+				CHECK_LE(vertex.x, 5.0 + epsilon);
+				CHECK_GE(vertex.z, -5.0 - epsilon);
+				CHECK_LE(vertex.z, 5.0 + epsilon);
+			}
+		}
+
+		SUBCASE("Tiles should be clipped to the filter baking AABB") {
+			// Crosses the tile borders at the origin and at x = -4.
+			const AABB filter_aabb(Vector3(-4.5, -1.0, -2.0), Vector3(6.0, 2.0, 4.0));
+			navigation_mesh->set_filter_baking_aabb(filter_aabb);
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+
+			const real_t epsilon = navigation_mesh->get_cell_size();
+			for (const Vector3 &vertex : navigation_mesh->get_vertices()) {
+				CHECK_GE(vertex.x, filter_aabb.position.x - epsilon);
+				CHECK_LE(vertex.x, filter_aabb.get_end().x + epsilon);
+				CHECK_GE(vertex.z, filter_aabb.position.z - epsilon);
+				CHECK_LE(vertex.z, filter_aabb.get_end().z + epsilon);
+			}
+		}
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should bake tiled navigation meshes with bounds off the cell grid") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		// The source geometry bounds at +-5.05 are not a multiple of the cell size.
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(10.1, 0.001, 10.1));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		navigation_mesh->set_tile_size(4.0);
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+
+		SUBCASE("Tile vertices should be on the world aligned cell grid") {
+			const real_t cell_size = navigation_mesh->get_cell_size();
+			for (const Vector3 &vertex : navigation_mesh->get_vertices()) {
+				CHECK(Math::is_equal_approx(vertex.x / cell_size, Math::round(vertex.x / cell_size), (real_t)0.01));
+				CHECK(Math::is_equal_approx(vertex.z / cell_size, Math::round(vertex.z / cell_size), (real_t)0.01));
+			}
+		}
+
+		SUBCASE("Tiles on the edges should be connected to their neighbors") {
+			RID map = navigation_server->map_create();
+			RID region = navigation_server->region_create();
+			navigation_server->map_set_active(map, true);
+			navigation_server->region_set_map(region, map);
+			navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+			navigation_server->process(0.0); // Give server some cycles to commit.
+
+			// Crosses the tile borders at x = -4 and z = -4 between the edge tiles and the inner ones.
+			const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-4.3, 0.0, -4.3), Vector3(-3.0, 0.0, -3.0), true);
+			CHECK_NE(path.size(), 0);
+			CHECK(path[path.size() - 1].is_equal_approx(navigation_server->map_get_closest_point(map, Vector3(-3.0, 0.0, -3.0))));
+
+			navigation_server->free(region);
+			navigation_server->free(map);
+			navigation_server->process(0.0); // Give server some cycles to commit.
+		}
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should drop one-way edge connections to updated regions") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		// Unit quad whose right edge connects to the slanted left edge of the other quad.
+		// The edge connection test is not symmetric, so the other quad doesn't connect back.
+		Ref<NavigationMesh> navigation_mesh_a = memnew(NavigationMesh);
+		Vector<Vector3> vertices_a;
+		vertices_a.push_back(Vector3(0, 0, 0));
+		vertices_a.push_back(Vector3(1, 0, 0));
+		vertices_a.push_back(Vector3(1, 0, 1));
+		vertices_a.push_back(Vector3(0, 0, 1));
+		navigation_mesh_a->set_vertices(vertices_a);
+		Ref<NavigationMesh> navigation_mesh_b = memnew(NavigationMesh);
+		Vector<Vector3> vertices_b;
+		vertices_b.push_back(Vector3(1.25, 0, 0.3));
+		vertices_b.push_back(Vector3(2, 0, 0.3));
+		vertices_b.push_back(Vector3(2, 0, 0.6));
+		vertices_b.push_back(Vector3(1.22, 0, 0.6));
+		navigation_mesh_b->set_vertices(vertices_b);
+		Vector<int> polygon;
+		polygon.push_back(0);
+		polygon.push_back(1);
+		polygon.push_back(2);
+		polygon.push_back(3);
+		navigation_mesh_a->add_polygon(polygon);
+		navigation_mesh_b->add_polygon(polygon);
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		RID region_a = navigation_server->region_create();
+		navigation_server->region_set_map(region_a, map);
+		navigation_server->region_set_navigation_mesh(region_a, navigation_mesh_a);
+		RID region_b = navigation_server->region_create();
+		navigation_server->region_set_map(region_b, map);
+		navigation_server->region_set_navigation_mesh(region_b, navigation_mesh_b);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+		REQUIRE_EQ(navigation_server->region_get_connections_count(region_a), 1);
+		REQUIRE_EQ(navigation_server->region_get_connections_count(region_b), 0);
+
+		// Only the region without the connection changes.
+		navigation_server->region_set_transform(region_b, Transform3D(Basis(), Vector3(10, 0, 0)));
+		navigation_server->process(0.0); // Give server some cycles to commit.
+		CHECK_EQ(navigation_server->region_get_connections_count(region_a), 0);
+		CHECK_EQ(navigation_server->region_get_connections_count(region_b), 0);
+
+		navigation_server->region_set_transform(region_b, Transform3D());
+		navigation_server->process(0.0); // Give server some cycles to commit.
+		CHECK_EQ(navigation_server->region_get_connections_count(region_a), 1);
+		CHECK_EQ(navigation_server->region_get_connections_count(region_b), 0);
+		const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(0.5, 0, 0.5), Vector3(1.9, 0, 0.45), true);
+		REQUIRE_GE(path.size(), 2);
+		CHECK(path[path.size() - 1].is_equal_approx(Vector3(1.9, 0, 0.45)));
+
+		navigation_server->free(region_b);
+		navigation_server->free(region_a);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
 	// FIXME: The race condition mentioned below is actually a problem and fails on CI (GH-90613).
 	/*
 	TEST_CASE("[NavigationServer3D] Server should be able to bake asynchronously") {
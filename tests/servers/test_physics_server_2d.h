@@ -0,0 +1,105 @@
+/**************************************************************************/
+/*  test_physics_server_2d.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_PHYSICS_SERVER_2D_H
+#define TEST_PHYSICS_SERVER_2D_H
+
+#include "servers/physics_server_2d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPhysicsServer2D {
+
+TEST_CASE("[SceneTree][PhysicsServer2D] Resting contacts follow shape changes") {
+	PhysicsServer2D *physics_server = PhysicsServer2D::get_singleton();
+
+	RID space = physics_server->space_create();
+	physics_server->space_set_active(space, true);
+	// Keep the small overlap below from being resolved, so the box stays in place.
+	physics_server->space_set_param(space, PhysicsServer2D::SPACE_PARAM_CONTACT_MAX_ALLOWED_PENETRATION, 0.3);
+
+	// A flat floor whose top is at y = 0.
+	PackedVector2Array floor_points;
+	floor_points.push_back(Vector2(-10, 0));
+	floor_points.push_back(Vector2(10, 0));
+	floor_points.push_back(Vector2(10, 2));
+	floor_points.push_back(Vector2(-10, 2));
+	RID floor_shape = physics_server->convex_polygon_shape_create();
+	physics_server->shape_set_data(floor_shape, floor_points);
+
+	RID floor = physics_server->body_create();
+	physics_server->body_set_mode(floor, PhysicsServer2D::BODY_MODE_STATIC);
+	physics_server->body_set_space(floor, space);
+	physics_server->body_add_shape(floor, floor_shape);
+
+	RID box_shape = physics_server->rectangle_shape_create();
+	physics_server->shape_set_data(box_shape, Vector2(0.5, 0.5));
+
+	// A box sinking 0.05 into the floor, without gravity.
+	const Transform2D box_transform(0, Vector2(8, -0.45));
+	RID box = physics_server->body_create();
+	physics_server->body_set_mode(box, PhysicsServer2D::BODY_MODE_RIGID);
+	physics_server->body_set_space(box, space);
+	physics_server->body_add_shape(box, box_shape);
+	physics_server->body_set_state(box, PhysicsServer2D::BODY_STATE_TRANSFORM, box_transform);
+	physics_server->body_set_state(box, PhysicsServer2D::BODY_STATE_CAN_SLEEP, false);
+	physics_server->body_set_param(box, PhysicsServer2D::BODY_PARAM_GRAVITY_SCALE, 0);
+	physics_server->body_set_max_contacts_reported(box, 4);
+
+	for (int i = 0; i < 3; i++) {
+		physics_server->step(1.0 / 60.0);
+	}
+
+	PhysicsDirectBodyState2D *box_state = physics_server->body_get_direct_state(box);
+	REQUIRE(box_state != nullptr);
+	CHECK(box_state->get_transform().is_equal_approx(box_transform));
+	CHECK(box_state->get_contact_count() > 0);
+
+	// A slope with the same bounds, which is below the box at x = 8. Neither body moves.
+	PackedVector2Array slope_points;
+	slope_points.push_back(Vector2(-10, 0));
+	slope_points.push_back(Vector2(10, 2));
+	slope_points.push_back(Vector2(-10, 2));
+	physics_server->shape_set_data(floor_shape, slope_points);
+
+	physics_server->step(1.0 / 60.0);
+
+	CHECK_MESSAGE(box_state->get_contact_count() == 0, "The contacts with the old shape should not be kept.");
+
+	physics_server->free(box);
+	physics_server->free(box_shape);
+	physics_server->free(floor);
+	physics_server->free(floor_shape);
+	physics_server->free(space);
+}
+
+} // namespace TestPhysicsServer2D
+
+#endif // TEST_PHYSICS_SERVER_2D_H
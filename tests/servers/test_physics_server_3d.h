@@ -0,0 +1,124 @@
+/**************************************************************************/
+/*  test_physics_server_3d.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_PHYSICS_SERVER_3D_H
+#define TEST_PHYSICS_SERVER_3D_H
+
+#include "servers/physics_server_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPhysicsServer3D {
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Casting many rays at once") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+
+	RID space = physics_server->space_create();
+	physics_server->space_set_active(space, true);
+
+	RID box = physics_server->box_shape_create();
+	physics_server->shape_set_data(box, Vector3(1, 1, 1));
+
+	RID body = physics_server->body_create();
+	physics_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_STATIC);
+	physics_server->body_set_space(body, space);
+	physics_server->body_add_shape(body, box);
+
+	PhysicsDirectSpaceState3D *space_state = physics_server->space_get_direct_state(space);
+	REQUIRE(space_state != nullptr);
+
+	// Enough rays to be split between tasks, half of them missing the box.
+	const int ray_count = 1000;
+	PackedVector3Array from;
+	PackedVector3Array to;
+	for (int i = 0; i < ray_count; i++) {
+		const real_t x = -2 + 4 * real_t(i) / ray_count;
+		from.push_back(Vector3(x, 5, 0.5));
+		to.push_back(Vector3(x, -5, 0.5));
+	}
+
+	Vector<PhysicsDirectSpaceState3D::RayResult> results;
+	results.resize(ray_count);
+	Vector<bool> hits;
+	hits.resize(ray_count);
+
+	PhysicsDirectSpaceState3D::RayParameters parameters;
+	const int hit_count = space_state->intersect_rays(parameters, from.ptr(), to.ptr(), ray_count, results.ptrw(), hits.ptrw());
+
+	int expected_hit_count = 0;
+	for (int i = 0; i < ray_count; i++) {
+		parameters.from = from[i];
+		parameters.to = to[i];
+		PhysicsDirectSpaceState3D::RayResult result;
+		const bool hit = space_state->intersect_ray(parameters, result);
+
+		CHECK_MESSAGE(hits[i] == hit, vformat("Ray %d should give the same result as a single ray cast.", i));
+		if (hit) {
+			expected_hit_count++;
+			CHECK(results[i].rid == body);
+			CHECK(results[i].position.is_equal_approx(result.position));
+			CHECK(results[i].normal.is_equal_approx(Vector3(0, 1, 0)));
+		}
+	}
+	CHECK(hit_count == expected_hit_count);
+	CHECK(hit_count > 0);
+	CHECK(hit_count < ray_count);
+
+	SUBCASE("The returned dictionary holds defined values for the missed rays") {
+		Ref<PhysicsRayQueryParameters3D> query;
+		query.instantiate();
+		Dictionary d = space_state->call("intersect_rays", query, from, to);
+
+		PackedByteArray hit = d["hit"];
+		PackedInt64Array collider_id = d["collider_id"];
+		PackedInt32Array shape = d["shape"];
+		PackedVector3Array position = d["position"];
+		REQUIRE(hit.size() == ray_count);
+		REQUIRE(collider_id.size() == ray_count);
+
+		for (int i = 0; i < ray_count; i++) {
+			if (hit[i]) {
+				CHECK(shape[i] == 0);
+			} else {
+				CHECK(collider_id[i] == 0);
+				CHECK(shape[i] == -1);
+				CHECK(position[i] == Vector3());
+			}
+		}
+	}
+
+	physics_server->free(body);
+	physics_server->free(box);
+	physics_server->free(space);
+}
+
+} // namespace TestPhysicsServer3D
+
+#endif // TEST_PHYSICS_SERVER_3D_H